@@ -0,0 +1,74 @@
+#include "counting_malloc.h"
+
+#include <stdlib.h>
+
+long long memLiveBytes = 0;
+long long memPeakLiveBytes = 0;
+long long memBaselineBytes = 0;
+size_t memAllocatedBytes = 0;
+size_t memAllocations = 0;
+
+#ifdef COUNTING_MALLOC_WRAP
+#include <malloc.h>
+
+/*
+ * Обёртки для ld --wrap=malloc,... : вызовы malloc в программе попадают в __wrap_malloc,
+ * настоящая функция доступна как __real_malloc.
+ * Живой объём считаем по malloc_usable_size — так верно освобождаются и блоки,
+ * выделенные внутри libc (strdup, getline), для которых обёртка не вызывалась
+ */
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+
+static void countAllocation(void *block, size_t size) {
+    if (block == NULL) return;
+    memLiveBytes += malloc_usable_size(block);
+    memAllocatedBytes += size;
+    memAllocations++;
+    if (memLiveBytes > memPeakLiveBytes) memPeakLiveBytes = memLiveBytes;
+}
+
+void *__wrap_malloc(size_t size) {
+    void *block = __real_malloc(size);
+    countAllocation(block, size);
+    return block;
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    void *block = __real_calloc(count, size);
+    countAllocation(block, count * size);
+    return block;
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    size_t old_size = ptr != NULL ? malloc_usable_size(ptr) : 0;
+    void *block = __real_realloc(ptr, size);
+    if (block == NULL) return NULL; // старый блок не тронут
+    memLiveBytes -= old_size;
+    countAllocation(block, size);
+    return block;
+}
+
+void __wrap_free(void *ptr) {
+    if (ptr == NULL) return;
+    memLiveBytes -= malloc_usable_size(ptr);
+    __real_free(ptr);
+}
+#endif
+
+void startMemoryMeasure(void) {
+    memAllocatedBytes = 0;
+    memAllocations = 0;
+    memBaselineBytes = memLiveBytes;
+    memPeakLiveBytes = memLiveBytes;
+}
+
+MemoryStats stopMemoryMeasure(void) {
+    MemoryStats stats;
+    stats.allocated_bytes = memAllocatedBytes;
+    stats.allocations = memAllocations;
+    stats.peak_bytes = (size_t) (memPeakLiveBytes - memBaselineBytes);
+    return stats;
+}
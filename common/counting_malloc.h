@@ -0,0 +1,21 @@
+#ifndef COUNTING_MALLOC_H
+#define COUNTING_MALLOC_H
+
+#include <stddef.h>
+
+/*
+ * Учёт памяти для C: malloc/calloc/realloc/free всей программы подменяются
+ * при компоновке (ld --wrap, см. counting_malloc.c), сами алгоритмы об этом не знают.
+ * Без поддержки --wrap счётчики остаются нулевыми
+ */
+typedef struct {
+    size_t allocated_bytes;  // сколько байт выделено за замер
+    size_t allocations;      // сколько было выделений
+    size_t peak_bytes;       // пик живой памяти сверх уровня на начало замера
+} MemoryStats;
+
+// Начало замера: обнуляем счётчики, пик отсчитываем от текущего живого объёма
+void startMemoryMeasure(void);
+MemoryStats stopMemoryMeasure(void);
+
+#endif
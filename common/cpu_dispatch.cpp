@@ -0,0 +1,50 @@
+#include "cpu_dispatch.h"
+
+#include <cstdlib>
+#include <cstring>
+
+static const char *ISA_NAMES[ISA_LEVEL_COUNT] = {"scalar", "sse4", "avx2", "avx512"};
+
+static IsaLevel selectedLevel = ISA_LEVEL_COUNT; // ещё не выбран
+
+IsaLevel detectIsaLevel() {
+#if ISA_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return ISA_AVX512;
+    if (__builtin_cpu_supports("avx2")) return ISA_AVX2;
+    if (__builtin_cpu_supports("sse4.2")) return ISA_SSE4;
+#endif
+    return ISA_SCALAR;
+}
+
+IsaLevel activeIsaLevel() {
+    if (selectedLevel == ISA_LEVEL_COUNT) {
+        IsaLevel level = detectIsaLevel();
+        const char *env = std::getenv("ISA_LEVEL");
+        IsaLevel requested;
+        if (env != nullptr && parseIsaLevel(env, requested) && requested < level) {
+            level = requested;
+        }
+        selectedLevel = level;
+    }
+    return selectedLevel;
+}
+
+void setIsaLevel(IsaLevel level) {
+    IsaLevel supported = detectIsaLevel();
+    selectedLevel = level < supported ? level : supported;
+}
+
+const char *isaName(IsaLevel level) {
+    return level < ISA_LEVEL_COUNT ? ISA_NAMES[level] : "unknown";
+}
+
+bool parseIsaLevel(const char *name, IsaLevel &level) {
+    for (int i = 0; i < ISA_LEVEL_COUNT; i++) {
+        if (std::strcmp(name, ISA_NAMES[i]) == 0) {
+            level = static_cast<IsaLevel>(i);
+            return true;
+        }
+    }
+    return false;
+}
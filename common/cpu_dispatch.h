@@ -0,0 +1,55 @@
+#ifndef CPU_DISPATCH_H
+#define CPU_DISPATCH_H
+
+/*
+ * Выбор набора инструкций во время выполнения.
+ * Ядра компилируются несколько раз с разными target-атрибутами,
+ * а нужный вариант выбирается по __builtin_cpu_supports
+ */
+
+enum IsaLevel {
+    ISA_SCALAR,
+    ISA_SSE4,
+    ISA_AVX2,
+    ISA_AVX512,
+    ISA_LEVEL_COUNT
+};
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ISA_DISPATCH 1
+#if defined(__clang__)
+#define TARGET_SCALAR
+#else
+// скалярный вариант без автовекторизации — точка отсчёта для остальных
+#define TARGET_SCALAR __attribute__((optimize("no-tree-vectorize")))
+#endif
+#define TARGET_SSE4 __attribute__((target("sse4.2")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#define TARGET_AVX512 __attribute__((target("avx512f")))
+// тело ядра встраивается в каждый вариант и компилируется под его набор инструкций
+#define KERNEL_BODY __attribute__((always_inline)) inline
+#else
+#define ISA_DISPATCH 0
+#define TARGET_SCALAR
+#define TARGET_SSE4
+#define TARGET_AVX2
+#define TARGET_AVX512
+#define KERNEL_BODY inline
+#endif
+
+// лучший уровень, который поддерживает процессор
+IsaLevel detectIsaLevel();
+
+// уровень, с которым работают ядра: по умолчанию лучший,
+// переменная окружения ISA_LEVEL (scalar, sse4, avx2, avx512) может его понизить
+IsaLevel activeIsaLevel();
+
+// понизить или вернуть уровень для замеров; выше поддерживаемого не поднимается
+void setIsaLevel(IsaLevel level);
+
+const char *isaName(IsaLevel level);
+
+// уровень по имени; false — если имя неизвестно
+bool parseIsaLevel(const char *name, IsaLevel &level);
+
+#endif
@@ -0,0 +1,58 @@
+#include "memory_counter.h"
+
+#include <cstdlib>
+#include <new>
+
+// Перед блоком хранится его размер, чтобы при освобождении уменьшить живой объём
+namespace memory_counter {
+    const size_t HEADER = alignof(std::max_align_t);
+
+    size_t live_bytes = 0;
+    size_t peak_live_bytes = 0;
+    size_t allocated_bytes = 0;
+    size_t allocations = 0;
+    size_t baseline_bytes = 0;
+}
+
+void* operator new(size_t size) {
+    using namespace memory_counter;
+    char* block = static_cast<char*>(std::malloc(size + HEADER));
+    if (block == nullptr) throw std::bad_alloc();
+    *reinterpret_cast<size_t*>(block) = size;
+
+    live_bytes += size;
+    allocated_bytes += size;
+    allocations++;
+    if (live_bytes > peak_live_bytes) peak_live_bytes = live_bytes;
+    return block + HEADER;
+}
+
+void operator delete(void* ptr) noexcept {
+    using namespace memory_counter;
+    if (ptr == nullptr) return;
+    char* block = static_cast<char*>(ptr) - HEADER;
+    live_bytes -= *reinterpret_cast<size_t*>(block);
+    std::free(block);
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete[](void* ptr) noexcept { operator delete(ptr); }
+void operator delete(void* ptr, size_t) noexcept { operator delete(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { operator delete(ptr); }
+
+void startMemoryMeasure() {
+    using namespace memory_counter;
+    allocated_bytes = 0;
+    allocations = 0;
+    baseline_bytes = live_bytes;
+    peak_live_bytes = live_bytes;
+}
+
+MemoryStats stopMemoryMeasure() {
+    using namespace memory_counter;
+    MemoryStats stats;
+    stats.allocated_bytes = allocated_bytes;
+    stats.allocations = allocations;
+    stats.peak_bytes = peak_live_bytes - baseline_bytes;
+    return stats;
+}
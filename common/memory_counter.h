@@ -0,0 +1,22 @@
+#ifndef MEMORY_COUNTER_H
+#define MEMORY_COUNTER_H
+
+#include <cstddef>
+
+/*
+ * Учёт памяти: глобальные operator new/delete заменены (memory_counter.cpp)
+ * и считают выделения всей программы
+ */
+
+struct MemoryStats {
+    size_t allocated_bytes = 0;  // сколько байт выделено за замер
+    size_t allocations = 0;      // сколько было выделений
+    size_t peak_bytes = 0;       // пик живой памяти сверх уровня на начало замера
+};
+
+// начало замера: обнуляем счётчики, пик отсчитываем от текущего живого объёма
+void startMemoryMeasure();
+
+MemoryStats stopMemoryMeasure();
+
+#endif
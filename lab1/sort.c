@@ -0,0 +1,301 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "sort.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+
+int hybridInsertionThreshold = 24;
+int hybridRadixThreshold = 4096;
+
+// Генерация лучшего случая (уже отсортированный массив)
+int *generateBestCase(int size) {
+    int *arr = (int *) malloc(size * sizeof(int));
+    for (int i = 0; i < size; i++) {
+        arr[i] = i;
+    }
+    return arr;
+}
+
+// Генерация худшего случая (обратный порядок)
+int *generateWorstCase(int size) {
+    int *arr = (int *) malloc(size * sizeof(int));
+    for (int i = 0; i < size; i++) {
+        arr[i] = size - i - 1;
+    }
+    return arr;
+}
+
+// Генерация случайного массива
+int *generateRandomCase(int size) {
+    int *arr = (int *) malloc(size * sizeof(int));
+    for (int i = 0; i < size; i++) {
+        arr[i] = rand() % (size * 10);
+    }
+    return arr;
+}
+
+// Копия массива (для переиспользования данных)
+int *copyArray(int *src, int size) {
+    int *dest = (int *) malloc(size * sizeof(int));
+    for (int i = 0; i < size; i++) {
+        dest[i] = src[i];
+    }
+    return dest;
+}
+
+void bubbleSort(int arr[], int n) {
+    int swapped;
+    for (int i = 0; i < n - 1; i++) {
+        swapped = 0;
+        for (int j = 0; j < n - i - 1; j++) {
+            if (arr[j] > arr[j + 1]) {
+                int temp = arr[j];
+                arr[j] = arr[j + 1];
+                arr[j + 1] = temp;
+                swapped = 1;
+            }
+        }
+        if (!swapped) break;
+    }
+}
+
+void insertionSort(int arr[], int n) {
+    for (int i = 1; i < n; i++) {
+        int key = arr[i];
+        int j = i - 1;
+        while (j >= 0 && arr[j] > key) {
+            arr[j + 1] = arr[j];
+            j--;
+        }
+        arr[j + 1] = key;
+    }
+}
+
+void selectionSort(int arr[], int n) {
+    for (int i = 0; i < n - 1; i++) {
+        int min_idx = i;
+        for (int j = i + 1; j < n; j++) {
+            if (arr[j] < arr[min_idx]) min_idx = j;
+        }
+        int temp = arr[min_idx];
+        arr[min_idx] = arr[i];
+        arr[i] = temp;
+    }
+}
+
+
+// Вставками, но не более limit сдвигов: 1 — отсортировано, 0 — лимит исчерпан
+int partialInsertionSort(int arr[], int n, long limit) {
+    long moves = 0;
+    for (int i = 1; i < n; i++) {
+        int key = arr[i];
+        int j = i - 1;
+        while (j >= 0 && arr[j] > key) {
+            arr[j + 1] = arr[j];
+            j--;
+        }
+        arr[j + 1] = key;
+        moves += i - 1 - j;
+        if (moves > limit) return 0;
+    }
+    return 1;
+}
+
+// Поразрядная сортировка (LSD, по байту за проход)
+void radixSort(int arr[], int n) {
+    unsigned int *buffer = (unsigned int *) malloc(n * sizeof(unsigned int));
+    unsigned int *src = (unsigned int *) arr;
+    unsigned int *dst = buffer;
+
+    // инвертируем знаковый бит, чтобы отрицательные шли раньше положительных
+    for (int i = 0; i < n; i++) src[i] ^= 0x80000000u;
+
+    for (int shift = 0; shift < 32; shift += 8) {
+        int count[257] = {0};
+        for (int i = 0; i < n; i++) count[((src[i] >> shift) & 0xFF) + 1]++;
+        for (int b = 0; b < 256; b++) count[b + 1] += count[b];
+        for (int i = 0; i < n; i++) dst[count[(src[i] >> shift) & 0xFF]++] = src[i];
+
+        unsigned int *temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    // после четырёх проходов данные снова в arr
+    for (int i = 0; i < n; i++) src[i] ^= 0x80000000u;
+    free(buffer);
+}
+
+void swapInts(int *a, int *b) {
+    int temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+// Быстрая сортировка с медианой трёх; короткие куски — вставками,
+// при слишком глубокой рекурсии — поразрядная, чтобы не уйти в O(n^2)
+void partitionSortRange(int arr[], int n, int depth) {
+    while (n > hybridInsertionThreshold) {
+        if (depth-- == 0) {
+            radixSort(arr, n);
+            return;
+        }
+
+        int mid = n / 2;
+        if (arr[mid] < arr[0]) swapInts(&arr[mid], &arr[0]);
+        if (arr[n - 1] < arr[0]) swapInts(&arr[n - 1], &arr[0]);
+        if (arr[n - 1] < arr[mid]) swapInts(&arr[n - 1], &arr[mid]);
+        int pivot = arr[mid];
+
+        int i = 0, j = n - 1;
+        while (i <= j) {
+            while (arr[i] < pivot) i++;
+            while (arr[j] > pivot) j--;
+            if (i <= j) {
+                swapInts(&arr[i], &arr[j]);
+                i++;
+                j--;
+            }
+        }
+
+        // рекурсия в меньшую часть, большая — в цикле
+        if (j + 1 < n - i) {
+            partitionSortRange(arr, j + 1, depth);
+            arr += i;
+            n -= i;
+        } else {
+            partitionSortRange(arr + i, n - i, depth);
+            n = j + 1;
+        }
+    }
+    insertionSort(arr, n);
+}
+
+void partitionSort(int arr[], int n) {
+    int depth = 0;
+    for (int m = n; m > 1; m >>= 1) depth += 2;
+    partitionSortRange(arr, n, depth);
+}
+
+/*
+ * Гибридная сортировка. Сначала проба упорядоченности (как в TimSort/pdqsort):
+ * одна неубывающая серия — уже готово, одна невозрастающая — разворот,
+ * мало нарушений — вставками с ограничением числа сдвигов.
+ * Иначе вставки, разбиение или поразрядная по калиброванным порогам
+ */
+void hybridSort(int arr[], int n) {
+    if (n < 2) return;
+    if (n <= hybridInsertionThreshold) {
+        insertionSort(arr, n);
+        return;
+    }
+
+    int ascents = 0, descents = 0;
+    for (int i = 1; i < n; i++) {
+        if (arr[i] > arr[i - 1]) ascents++;
+        else if (arr[i] < arr[i - 1]) descents++;
+    }
+
+    if (descents == 0) return;
+    if (ascents == 0) {
+        for (int i = 0, j = n - 1; i < j; i++, j--) swapInts(&arr[i], &arr[j]);
+        return;
+    }
+    if (descents <= n / 64 && partialInsertionSort(arr, n, n)) return;
+
+    if (n >= hybridRadixThreshold) radixSort(arr, n);
+    else partitionSort(arr, n);
+}
+
+double currentTimeMs(void) {
+#ifdef _WIN32
+    LARGE_INTEGER freq, now;
+    QueryPerformanceFrequency(&freq); // Получаем частоту таймера
+    QueryPerformanceCounter(&now);
+    return (double) now.QuadPart * 1000.0 / freq.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000.0 + now.tv_nsec / 1000000.0;
+#endif
+}
+
+// Среднее время сортировки случайных массивов размера size (runs повторов)
+double averageRandomTime(int size, int runs, void (*sortFunc)(int*, int)) {
+    double total = 0;
+    for (int r = 0; r < runs; r++) {
+        int *arr = generateRandomCase(size);
+        int *data = copyArray(arr, size);
+        double start = currentTimeMs();
+        sortFunc(data, size);
+        total += currentTimeMs() - start;
+        free(data);
+        free(arr);
+    }
+    return total / runs;
+}
+
+/*
+ * Пороги гибридной сортировки: читаем из THRESHOLDS_FILE, а если его нет —
+ * калибруем на этой машине и сохраняем
+ */
+void calibrateHybridSort(void) {
+    FILE* file = fopen(THRESHOLDS_FILE, "r");
+    if (file != NULL) {
+        int insertion, radix;
+        // испорченный файл (например, отрицательный порог) не берём — калибруем заново
+        if (fscanf(file, "insertion=%d\nradix=%d", &insertion, &radix) == 2 &&
+            insertion >= 1 && radix >= insertion) {
+            hybridInsertionThreshold = insertion;
+            hybridRadixThreshold = radix;
+            fclose(file);
+            printf("Пороги из %s: вставки до %d, поразрядная от %d\n", THRESHOLDS_FILE, insertion, radix);
+            return;
+        }
+        fclose(file);
+    }
+
+    printf("Калибровка гибридной сортировки...\n");
+
+    // порог вставок: при каком размере куска быстрая сортировка работает быстрее всего
+    const int cutoffs[] = {4, 8, 12, 16, 24, 32, 48, 64};
+    const int num_cutoffs = sizeof(cutoffs) / sizeof(cutoffs[0]);
+    double best_time = -1;
+    int best_cutoff = hybridInsertionThreshold;
+    for (int i = 0; i < num_cutoffs; i++) {
+        hybridInsertionThreshold = cutoffs[i];
+        double time = averageRandomTime(2000, 50, partitionSort);
+        if (best_time < 0 || time < best_time) {
+            best_time = time;
+            best_cutoff = cutoffs[i];
+        }
+    }
+    hybridInsertionThreshold = best_cutoff;
+
+    // порог поразрядной: наименьший размер, с которого она обгоняет разбиение
+    const int sizes[] = {64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, 32768};
+    const int num_sizes = sizeof(sizes) / sizeof(sizes[0]);
+    hybridRadixThreshold = 1 << 30;
+    for (int i = 0; i < num_sizes; i++) {
+        int runs = 200000 / sizes[i] + 5;
+        if (averageRandomTime(sizes[i], runs, radixSort) < averageRandomTime(sizes[i], runs, partitionSort)) {
+            hybridRadixThreshold = sizes[i];
+            break;
+        }
+    }
+
+    file = fopen(THRESHOLDS_FILE, "w");
+    if (file != NULL) {
+        fprintf(file, "insertion=%d\nradix=%d\n", hybridInsertionThreshold, hybridRadixThreshold);
+        fclose(file);
+    }
+    printf("Пороги: вставки до %d, поразрядная от %d (сохранены в %s)\n",
+           hybridInsertionThreshold, hybridRadixThreshold, THRESHOLDS_FILE);
+}
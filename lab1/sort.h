@@ -0,0 +1,31 @@
+#ifndef SORT_H
+#define SORT_H
+
+// Файл, в котором кэшируются пороги гибридной сортировки для этой машины
+#define THRESHOLDS_FILE "hybrid_thresholds.txt"
+
+// Пороги гибридной сортировки: до insertion — сортировка вставками,
+// от radix — поразрядная, между ними — разбиение. Уточняются калибровкой
+extern int hybridInsertionThreshold;
+extern int hybridRadixThreshold;
+
+// Генерация входных данных: отсортированный, обратный порядок, случайный
+int *generateBestCase(int size);
+int *generateWorstCase(int size);
+int *generateRandomCase(int size);
+int *copyArray(int *src, int size);
+
+void bubbleSort(int arr[], int n);
+void insertionSort(int arr[], int n);
+void selectionSort(int arr[], int n);
+void partitionSort(int arr[], int n);
+void radixSort(int arr[], int n);
+void hybridSort(int arr[], int n);
+
+// Монотонное время в миллисекундах
+double currentTimeMs(void);
+
+// Пороги гибридной сортировки: из THRESHOLDS_FILE или калибровкой на этой машине
+void calibrateHybridSort(void);
+
+#endif
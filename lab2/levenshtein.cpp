@@ -0,0 +1,101 @@
+#include "levenshtein.h"
+
+#include <algorithm>
+#include <climits>
+#include <random>
+
+using namespace std;
+
+// Итеративный Левенштейн
+int iterativeLevenshtein(const string& s1, const string& s2) {
+    size_t n = s1.size(), m = s2.size();
+    vector<vector<int>> dp(n + 1, vector<int>(m + 1));
+
+    for (size_t i = 0; i <= n; ++i) dp[i][0] = i;
+    for (size_t j = 0; j <= m; ++j) dp[0][j] = j;
+
+    for (size_t i = 1; i <= n; ++i) {
+        for (size_t j = 1; j <= m; ++j) {
+            int cost = (s1[i-1] == s2[j-1]) ? 0 : 1;
+            dp[i][j] = min({
+                                   dp[i-1][j] + 1,
+                                   dp[i][j-1] + 1,
+                                   dp[i-1][j-1] + cost
+                           });
+        }
+    }
+    return dp[n][m];
+}
+
+// Итеративный Дамерау-Левенштейн
+int iterativeDamerauLevenshtein(const string& s1, const string& s2) {
+    size_t n = s1.size(), m = s2.size();
+    vector<vector<int>> dp(n + 1, vector<int>(m + 1));
+
+    for (size_t i = 0; i <= n; ++i) dp[i][0] = i;
+    for (size_t j = 0; j <= m; ++j) dp[0][j] = j;
+
+    for (size_t i = 1; i <= n; ++i) {
+        for (size_t j = 1; j <= m; ++j) {
+            int cost = (s1[i-1] == s2[j-1]) ? 0 : 1;
+            dp[i][j] = min({
+                                   dp[i-1][j] + 1,
+                                   dp[i][j-1] + 1,
+                                   dp[i-1][j-1] + cost
+                           });
+
+            if (i > 1 && j > 1 && s1[i-2] == s2[j-1] && s1[i-1] == s2[j-2]) {
+                dp[i][j] = min(dp[i][j], dp[i-2][j-2] + cost);
+            }
+        }
+    }
+    return dp[n][m];
+}
+
+// Рекурсивный Дамерау-Левенштейн (без кэша)
+int recursiveDamerau(const string& s1, const string& s2, int i, int j) {
+    if (i == 0) return j;
+    if (j == 0) return i;
+
+    int cost = (s1[i-1] == s2[j-1]) ? 0 : 1;
+    int ins = recursiveDamerau(s1, s2, i, j-1) + 1;
+    int del = recursiveDamerau(s1, s2, i-1, j) + 1;
+    int subst = recursiveDamerau(s1, s2, i-1, j-1) + cost;
+    int res = min({ins, del, subst});
+
+    if (i > 1 && j > 1 && s1[i-2] == s2[j-1] && s1[i-1] == s2[j-2]) {
+        int trans = recursiveDamerau(s1, s2, i-2, j-2) + cost;
+        res = min(res, trans);
+    }
+    return res;
+}
+
+// Рекурсивный Дамерау-Левенштейн с кэшем
+int recursiveDamerauCache(const string& s1, const string& s2, int i, int j, vector<vector<int>>& cache) {
+    if (cache[i][j] != INT_MAX) return cache[i][j];
+
+    if (i == 0) return cache[i][j] = j;
+    if (j == 0) return cache[i][j] = i;
+
+    int cost = (s1[i-1] == s2[j-1]) ? 0 : 1;
+    int ins = recursiveDamerauCache(s1, s2, i, j-1, cache) + 1;
+    int del = recursiveDamerauCache(s1, s2, i-1, j, cache) + 1;
+    int subst = recursiveDamerauCache(s1, s2, i-1, j-1, cache) + cost;
+    int res = min({ins, del, subst});
+
+    if (i > 1 && j > 1 && s1[i-2] == s2[j-1] && s1[i-1] == s2[j-2]) {
+        int trans = recursiveDamerauCache(s1, s2, i-2, j-2, cache) + cost;
+        res = min(res, trans);
+    }
+    return cache[i][j] = res;
+}
+
+// Генератор случайных строк
+string randomString(size_t length) {
+    static mt19937 gen(random_device{}());
+    uniform_int_distribution<> dist(0, 25);
+    string s;
+    for (size_t i = 0; i < length; ++i)
+        s += static_cast<char>('a' + dist(gen));
+    return s;
+}
@@ -0,0 +1,18 @@
+#ifndef LEVENSHTEIN_H
+#define LEVENSHTEIN_H
+
+#include <string>
+#include <vector>
+
+// Итеративные Левенштейн и Дамерау-Левенштейн (матрица (n+1) x (m+1))
+int iterativeLevenshtein(const std::string& s1, const std::string& s2);
+int iterativeDamerauLevenshtein(const std::string& s1, const std::string& s2);
+
+// Рекурсивный Дамерау-Левенштейн: без кэша и с кэшем (cache заполнен INT_MAX)
+int recursiveDamerau(const std::string& s1, const std::string& s2, int i, int j);
+int recursiveDamerauCache(const std::string& s1, const std::string& s2, int i, int j, std::vector<std::vector<int>>& cache);
+
+// Генератор случайных строк из латинских строчных букв
+std::string randomString(size_t length);
+
+#endif
@@ -3,7 +3,6 @@
 #include <string>
 #include <algorithm>
 #include <chrono>
-#include <random>
 #include <iomanip>
 #include <climits>
 #include <fstream>
@@ -12,157 +11,85 @@
 #include <x86intrin.h>
 #endif
 
+#include "levenshtein.h"
+#include "../common/memory_counter.h"
+
 using namespace std;
 
 uint64_t get_cycles() {
     return __rdtsc();
 }
 
-// Итеративный Левенштейн
-int iterativeLevenshtein(const string& s1, const string& s2) {
-    size_t n = s1.size(), m = s2.size();
-    vector<vector<int>> dp(n + 1, vector<int>(m + 1));
-
-    for (size_t i = 0; i <= n; ++i) dp[i][0] = i;
-    for (size_t j = 0; j <= m; ++j) dp[0][j] = j;
-
-    for (size_t i = 1; i <= n; ++i) {
-        for (size_t j = 1; j <= m; ++j) {
-            int cost = (s1[i-1] == s2[j-1]) ? 0 : 1;
-            dp[i][j] = min({
-                                   dp[i-1][j] + 1,
-                                   dp[i][j-1] + 1,
-                                   dp[i-1][j-1] + cost
-                           });
-        }
-    }
-    return dp[n][m];
-}
-
-// Итеративный Дамерау-Левенштейн
-int iterativeDamerauLevenshtein(const string& s1, const string& s2) {
-    size_t n = s1.size(), m = s2.size();
-    vector<vector<int>> dp(n + 1, vector<int>(m + 1));
-
-    for (size_t i = 0; i <= n; ++i) dp[i][0] = i;
-    for (size_t j = 0; j <= m; ++j) dp[0][j] = j;
-
-    for (size_t i = 1; i <= n; ++i) {
-        for (size_t j = 1; j <= m; ++j) {
-            int cost = (s1[i-1] == s2[j-1]) ? 0 : 1;
-            dp[i][j] = min({
-                                   dp[i-1][j] + 1,
-                                   dp[i][j-1] + 1,
-                                   dp[i-1][j-1] + cost
-                           });
-
-            if (i > 1 && j > 1 && s1[i-2] == s2[j-1] && s1[i-1] == s2[j-2]) {
-                dp[i][j] = min(dp[i][j], dp[i-2][j-2] + cost);
-            }
-        }
-    }
-    return dp[n][m];
-}
-
-// Рекурсивный Дамерау-Левенштейн (без кэша)
-int recursiveDamerau(const string& s1, const string& s2, int i, int j) {
-    if (i == 0) return j;
-    if (j == 0) return i;
-
-    int cost = (s1[i-1] == s2[j-1]) ? 0 : 1;
-    int ins = recursiveDamerau(s1, s2, i, j-1) + 1;
-    int del = recursiveDamerau(s1, s2, i-1, j) + 1;
-    int subst = recursiveDamerau(s1, s2, i-1, j-1) + cost;
-    int res = min({ins, del, subst});
-
-    if (i > 1 && j > 1 && s1[i-2] == s2[j-1] && s1[i-1] == s2[j-2]) {
-        int trans = recursiveDamerau(s1, s2, i-2, j-2) + cost;
-        res = min(res, trans);
-    }
-    return res;
-}
-
-// Рекурсивный Дамерау-Левенштейн с кэшем
-int recursiveDamerauCache(const string& s1, const string& s2, int i, int j, vector<vector<int>>& cache) {
-    if (cache[i][j] != INT_MAX) return cache[i][j];
-
-    if (i == 0) return cache[i][j] = j;
-    if (j == 0) return cache[i][j] = i;
-
-    int cost = (s1[i-1] == s2[j-1]) ? 0 : 1;
-    int ins = recursiveDamerauCache(s1, s2, i, j-1, cache) + 1;
-    int del = recursiveDamerauCache(s1, s2, i-1, j, cache) + 1;
-    int subst = recursiveDamerauCache(s1, s2, i-1, j-1, cache) + cost;
-    int res = min({ins, del, subst});
-
-    if (i > 1 && j > 1 && s1[i-2] == s2[j-1] && s1[i-1] == s2[j-2]) {
-        int trans = recursiveDamerauCache(s1, s2, i-2, j-2, cache) + cost;
-        res = min(res, trans);
-    }
-    return cache[i][j] = res;
-}
-
-// Генератор случайных строк
-string randomString(size_t length) {
-    static mt19937 gen(random_device{}());
-    uniform_int_distribution<> dist(0, 25);
-    string s;
-    for (size_t i = 0; i < length; ++i)
-        s += static_cast<char>('a' + dist(gen));
-    return s;
+// колонки памяти одного алгоритма: выделено байт, число выделений, пик живой памяти
+void writeMemory(ofstream& csv, const MemoryStats& mem) {
+    csv << mem.allocated_bytes << ";" << mem.allocations << ";" << mem.peak_bytes;
 }
 
 void runTests() {
     ofstream csv("results.csv");
     csv << "Длина;"
-        << "Левенштейн (такты);Левенштейн (память);"
-        << "Дамерау Итер (такты);Дамерау Итер (память);"
-        << "Дамерау Кэш (такты);Дамерау Кэш (память);"
-        << "Дамерау Рекурс (такты)\n";
+        << "Левенштейн (такты);Левенштейн (байт);Левенштейн (выделений);Левенштейн (пик байт);"
+        << "Дамерау Итер (такты);Дамерау Итер (байт);Дамерау Итер (выделений);Дамерау Итер (пик байт);"
+        << "Дамерау Кэш (такты);Дамерау Кэш (байт);Дамерау Кэш (выделений);Дамерау Кэш (пик байт);"
+        << "Дамерау Рекурс (такты);Дамерау Рекурс (байт);Дамерау Рекурс (выделений);Дамерау Рекурс (пик байт)\n";
 
     vector<int> lengths = {1, 2, 3, 4, 5, 10};
 
     for (int len : lengths) {
         double t_lev = 0, t_dam_iter = 0, t_dam_cache = 0, t_dam_recur = 0;
-        size_t mem_lev = 0, mem_dam_iter = 0, mem_dam_cache = 0;
+        MemoryStats mem_lev, mem_dam_iter, mem_dam_cache, mem_dam_recur;
 
         for (int i = 0; i < 100; ++i) {
             string s1 = randomString(len);
             string s2 = randomString(len);
 
             // Итеративный Левенштейн
+            startMemoryMeasure();
             uint64_t start = get_cycles();
             iterativeLevenshtein(s1, s2);
             t_lev += (get_cycles() - start);
-            mem_lev = (len+1)*(len+1)*sizeof(int);
+            mem_lev = stopMemoryMeasure();
 
             // Итеративный Дамерау
+            startMemoryMeasure();
             start = get_cycles();
             iterativeDamerauLevenshtein(s1, s2);
             t_dam_iter += (get_cycles() - start);
-            mem_dam_iter = (len+1)*(len+1)*sizeof(int);
+            mem_dam_iter = stopMemoryMeasure();
 
-            // Рекурсивный с кэшем
-            vector<vector<int>> cache(len+1, vector<int>(len+1, INT_MAX));
-            start = get_cycles();
-            recursiveDamerauCache(s1, s2, len, len, cache);
-            t_dam_cache += (get_cycles() - start);
-            mem_dam_cache = (len+1)*(len+1)*sizeof(int);
+            // Рекурсивный с кэшем (кэш в такты не входит, но в память — входит)
+            startMemoryMeasure();
+            {
+                vector<vector<int>> cache(len+1, vector<int>(len+1, INT_MAX));
+                start = get_cycles();
+                recursiveDamerauCache(s1, s2, len, len, cache);
+                t_dam_cache += (get_cycles() - start);
+            }
+            mem_dam_cache = stopMemoryMeasure();
 
             // Рекурсивный без кэша
             if (len <= 5) {
+                startMemoryMeasure();
                 start = get_cycles();
                 recursiveDamerau(s1, s2, len, len);
                 t_dam_recur += (get_cycles() - start);
+                mem_dam_recur = stopMemoryMeasure();
             }
         }
 
-        csv << len << ";"
-            << t_lev/100 << ";" << mem_lev << ";"
-            << t_dam_iter/100 << ";" << mem_dam_iter << ";"
-            << t_dam_cache/100 << ";" << mem_dam_cache << ";"
-            << (len <=5 ? to_string(t_dam_recur/100) : "N/A")
-            << "\n";
+        csv << len << ";" << t_lev/100 << ";";
+        writeMemory(csv, mem_lev);
+        csv << ";" << t_dam_iter/100 << ";";
+        writeMemory(csv, mem_dam_iter);
+        csv << ";" << t_dam_cache/100 << ";";
+        writeMemory(csv, mem_dam_cache);
+        if (len <= 5) {
+            csv << ";" << t_dam_recur/100 << ";";
+            writeMemory(csv, mem_dam_recur);
+        } else {
+            csv << ";N/A;N/A;N/A;N/A";
+        }
+        csv << "\n";
     }
     csv.close();
 }
@@ -0,0 +1,184 @@
+#ifndef FIXED_MATRIX_H
+#define FIXED_MATRIX_H
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include "../common/cpu_dispatch.h"
+
+/*
+ * Умножение маленьких матриц фиксированного размера (4x4 ... 32x32).
+ * Размеры — параметры шаблона, поэтому суммы по общему измерению
+ * разворачиваются полностью, буферы rowFactor/colFactor не нужны,
+ * а ветка нечётного M выбирается при компиляции.
+ * Ядра встраиваются в варианты пакетного умножения под SSE4/AVX2/AVX-512
+ */
+
+// Матрица Rows x Cols по строкам в std::array
+template<int Rows, int Cols>
+struct FixedMatrix {
+    static_assert(Rows > 0 && Cols > 0, "размеры матрицы должны быть положительными");
+
+    std::array<int, Rows * Cols> data{};
+
+    constexpr int &operator()(int i, int j) { return data[i * Cols + j]; }
+    constexpr const int &operator()(int i, int j) const { return data[i * Cols + j]; }
+};
+
+namespace fixed_detail {
+    // c[j] += a * x[j] по строке длины K
+    template<int K>
+    KERNEL_BODY constexpr void axpyRow(int *c, const int *x, int a) {
+        for (int j = 0; j < K; ++j)
+            c[j] += a * x[j];
+    }
+
+    // c[j] += x[j] * y[j]
+    template<int K>
+    KERNEL_BODY constexpr void mulAddRow(int *c, const int *x, const int *y) {
+        for (int j = 0; j < K; ++j)
+            c[j] += x[j] * y[j];
+    }
+
+    // c[j] += (a0 + x[j]) * (a1 + y[j])
+    template<int K>
+    KERNEL_BODY constexpr void winogradRow(int *c, const int *x, const int *y, int a0, int a1) {
+        for (int j = 0; j < K; ++j)
+            c[j] += (a0 + x[j]) * (a1 + y[j]);
+    }
+
+    // строка C обычным алгоритмом: по одному слагаемому на каждую строку B
+    template<int K, size_t... R>
+    KERNEL_BODY constexpr void classicRow(const int *a_row, const int *b, int *c_row, std::index_sequence<R...>) {
+        (axpyRow<K>(c_row, b + R * K, a_row[R]), ...);
+    }
+
+    // colFactor[j] — сумма b[2p][j] * b[2p + 1][j] по парам строк B
+    template<int K, size_t... P>
+    KERNEL_BODY constexpr void colFactor(const int *b, int *factor, std::index_sequence<P...>) {
+        (mulAddRow<K>(factor, b + 2 * P * K, b + (2 * P + 1) * K), ...);
+    }
+
+    // rowFactor — сумма a[2p] * a[2p + 1]
+    template<size_t... P>
+    KERNEL_BODY constexpr int rowFactor(const int *a_row, std::index_sequence<P...>) {
+        return (0 + ... + (a_row[2 * P] * a_row[2 * P + 1]));
+    }
+
+    // основная сумма Винограда по парам, сразу для всей строки C
+    template<int K, size_t... P>
+    KERNEL_BODY constexpr void winogradPairs(const int *a_row, const int *b, int *c_row, std::index_sequence<P...>) {
+        (winogradRow<K>(c_row, b + (2 * P + 1) * K, b + 2 * P * K, a_row[2 * P], a_row[2 * P + 1]), ...);
+    }
+}
+
+// Обычный алгоритм над указателями: A — N x M, B — M x K, C — N x K, всё по строкам.
+// Строка C копится в локальном буфере: он не может пересекаться с B,
+// и компилятор векторизует ядра без проверок во время выполнения
+template<int N, int M, int K>
+KERNEL_BODY constexpr void multiplyClassicRaw(const int *a, const int *b, int *c) {
+    for (int i = 0; i < N; ++i) {
+        int row[K] = {};
+        fixed_detail::classicRow<K>(a + i * M, b, row, std::make_index_sequence<M>{});
+        for (int j = 0; j < K; ++j)
+            c[i * K + j] = row[j];
+    }
+}
+
+// Виноград над указателями; для нечётного M хвост добавляется без проверки во время выполнения
+template<int N, int M, int K>
+KERNEL_BODY constexpr void multiplyWinogradRaw(const int *a, const int *b, int *c) {
+    constexpr auto pairs = std::make_index_sequence<M / 2>{};
+
+    int colFactor[K] = {};
+    fixed_detail::colFactor<K>(b, colFactor, pairs);
+
+    for (int i = 0; i < N; ++i) {
+        const int *a_row = a + i * M;
+        int rowFactor = fixed_detail::rowFactor(a_row, pairs);
+        int row[K] = {};
+        for (int j = 0; j < K; ++j)
+            row[j] = -(rowFactor + colFactor[j]);
+        fixed_detail::winogradPairs<K>(a_row, b, row, pairs);
+        if constexpr (M % 2 == 1)
+            fixed_detail::axpyRow<K>(row, b + (M - 1) * K, a_row[M - 1]);
+        for (int j = 0; j < K; ++j)
+            c[i * K + j] = row[j];
+    }
+}
+
+#define DEFINE_FIXED_BATCH(SUFFIX, TARGET)                                                     \
+    template<int N, int M, int K, bool Winograd>                                               \
+    TARGET void multiplyBatch##SUFFIX(const int *a, size_t stride_a, const int *b, size_t stride_b, \
+                                      int *c, size_t stride_c, size_t count) {                 \
+        for (size_t p = 0; p < count; ++p) {                                                   \
+            if constexpr (Winograd)                                                            \
+                multiplyWinogradRaw<N, M, K>(a + p * stride_a, b + p * stride_b, c + p * stride_c); \
+            else                                                                               \
+                multiplyClassicRaw<N, M, K>(a + p * stride_a, b + p * stride_b, c + p * stride_c); \
+        }                                                                                      \
+    }
+
+namespace fixed_detail {
+    DEFINE_FIXED_BATCH(Scalar, TARGET_SCALAR)
+    DEFINE_FIXED_BATCH(Sse4, TARGET_SSE4)
+    DEFINE_FIXED_BATCH(Avx2, TARGET_AVX2)
+    DEFINE_FIXED_BATCH(Avx512, TARGET_AVX512)
+
+    template<int N, int M, int K, bool Winograd>
+    void multiplyBatchDispatch(const int *a, size_t stride_a, const int *b, size_t stride_b,
+                               int *c, size_t stride_c, size_t count) {
+        switch (activeIsaLevel()) {
+            case ISA_AVX512:
+                multiplyBatchAvx512<N, M, K, Winograd>(a, stride_a, b, stride_b, c, stride_c, count);
+                break;
+            case ISA_AVX2:
+                multiplyBatchAvx2<N, M, K, Winograd>(a, stride_a, b, stride_b, c, stride_c, count);
+                break;
+            case ISA_SSE4:
+                multiplyBatchSse4<N, M, K, Winograd>(a, stride_a, b, stride_b, c, stride_c, count);
+                break;
+            default:
+                multiplyBatchScalar<N, M, K, Winograd>(a, stride_a, b, stride_b, c, stride_c, count);
+        }
+    }
+}
+
+// Умножение по Винограду: одна пара идёт через те же варианты под набор инструкций,
+// что и пакет (шаблон без target-атрибута собрался бы только под базовый набор)
+template<int N, int M, int K>
+FixedMatrix<N, K> multiply(const FixedMatrix<N, M> &a, const FixedMatrix<M, K> &b) {
+    FixedMatrix<N, K> c;
+    fixed_detail::multiplyBatchDispatch<N, M, K, true>(a.data.data(), N * M, b.data.data(), M * K,
+                                                       c.data.data(), N * K, 1);
+    return c;
+}
+
+// Умножение обычным алгоритмом
+template<int N, int M, int K>
+FixedMatrix<N, K> multiplyClassic(const FixedMatrix<N, M> &a, const FixedMatrix<M, K> &b) {
+    FixedMatrix<N, K> c;
+    fixed_detail::multiplyBatchDispatch<N, M, K, false>(a.data.data(), N * M, b.data.data(), M * K,
+                                                        c.data.data(), N * K, 1);
+    return c;
+}
+
+/*
+ * Пакетное умножение count пар из непрерывных буферов.
+ * Шаг (stride) — расстояние в int между соседними матрицами буфера,
+ * не меньше размера самой матрицы
+ */
+template<int N, int M, int K>
+void multiplyBatch(const int *a, size_t stride_a, const int *b, size_t stride_b,
+                   int *c, size_t stride_c, size_t count) {
+    fixed_detail::multiplyBatchDispatch<N, M, K, true>(a, stride_a, b, stride_b, c, stride_c, count);
+}
+
+template<int N, int M, int K>
+void multiplyClassicBatch(const int *a, size_t stride_a, const int *b, size_t stride_b,
+                          int *c, size_t stride_c, size_t count) {
+    fixed_detail::multiplyBatchDispatch<N, M, K, false>(a, stride_a, b, stride_b, c, stride_c, count);
+}
+
+#endif
@@ -6,141 +6,147 @@
 #include <fstream>
 #include <tuple>
 
+#include "matrix.h"
+#include "fixed_matrix.h"
+#include "../common/cpu_dispatch.h"
+#include "../common/memory_counter.h"
+
 using namespace std;
 using namespace std::chrono;
 
-// Функция умножения матриц — обычный алгоритм
-vector<vector<int>> multiplyMatrixDefault(const vector<vector<int>> &a, const vector<vector<int>> &b) {
-    int l = a.size();
-    int m = a[0].size();
-    int n = b[0].size();
-
-    vector<vector<int>> c(l, vector<int>(n, 0));
+// время одного умножения и память, выделенная за него (включая результат)
+struct Measurement {
+    double time;
+    MemoryStats memory;
+};
 
-    for (int i = 0; i < l; i++) {
-        for (int j = 0; j < n; j++) {
-            for (int r = 0; r < m; r++) {
-                c[i][j] += a[i][r] * b[r][j];
-            }
-        }
+template<typename Func>
+Measurement measureTime(Func func, const vector<vector<int>> &a, const vector<vector<int>> &b) {
+    Measurement result;
+    startMemoryMeasure();
+    {
+        auto start = high_resolution_clock::now();
+        auto c = func(a, b);
+        auto stop = high_resolution_clock::now();
+        result.time = duration<double>(stop - start).count();
     }
-
-    return c;
+    result.memory = stopMemoryMeasure();
+    return result;
 }
 
-// Умножение матриц по алгоритму Винограда
-vector<vector<int>> multiplyMatrixVinograd(const vector<vector<int>> &a, const vector<vector<int>> &b) {
-    int n = a.size();
-    int m = a[0].size();
-    int k = b[0].size();
-
-    vector<int> rowFactor(n, 0);
-    vector<int> colFactor(k, 0);
-    vector<vector<int>> c(n, vector<int>(k, 0));
-
-    for (int i = 0; i < n; ++i) {
-        for (int j = 0; j < m / 2; ++j) {
-            rowFactor[i] += a[i][2 * j] * a[i][2 * j + 1];
-        }
+void saveToCSV(const string &filename, const vector<tuple<int, string, Measurement, Measurement, Measurement, Measurement>> &data) {
+    ofstream file(filename);
+    if (!file.is_open()) {
+        cerr << "Ошибка открытия файла: " << filename << endl;
+        return;
     }
-
-    for (int i = 0; i < k; ++i) {
-        for (int j = 0; j < m / 2; ++j) {
-            colFactor[i] += b[2 * j][i] * b[2 * j + 1][i];
+    file << "Size,Type,Default,Winograd,Optimized_Winograd,Rows_Winograd";
+    for (const char *name: {"Default", "Winograd", "Optimized_Winograd", "Rows_Winograd"}) {
+        file << "," << name << "_Bytes," << name << "_Allocs," << name << "_PeakBytes";
+    }
+    file << "\n";
+    for (const auto &[size, type, defaultTime, winogradTime, optimizedTime, rowsTime]: data) {
+        file << size << "," << type << "," << defaultTime.time << "," << winogradTime.time << "," << optimizedTime.time
+             << "," << rowsTime.time;
+        for (const Measurement &m: {defaultTime, winogradTime, optimizedTime, rowsTime}) {
+            file << "," << m.memory.allocated_bytes << "," << m.memory.allocations << "," << m.memory.peak_bytes;
         }
+        file << "\n";
     }
+    file.close();
+}
 
-    for (int i = 0; i < n; ++i) {
-        for (int j = 0; j < k; ++j) {
-            c[i][j] = -(rowFactor[i] + colFactor[j]);
-            for (int l = 0; l < m / 2; ++l) {
-                c[i][j] += (a[i][2 * l] + b[2 * l + 1][j]) * (a[i][2 * l + 1] + b[2 * l][j]);
-            }
-        }
+// Виноград по строкам на каждом поддерживаемом наборе инструкций
+void saveIsaComparison(const string &filename, const vector<int> &sizes) {
+    ofstream file(filename);
+    if (!file.is_open()) {
+        cerr << "Ошибка открытия файла: " << filename << endl;
+        return;
     }
+    file << "Size,Isa,Rows_Winograd\n";
 
-    if (m % 2 == 1) {
-        for (int i = 0; i < n; ++i) {
-            for (int j = 0; j < k; ++j) {
-                c[i][j] += a[i][m - 1] * b[m - 1][j];
-            }
+    // после замеров возвращаем прежний уровень, чтобы не потерять ограничение ISA_LEVEL
+    IsaLevel previous = activeIsaLevel();
+    IsaLevel detected = detectIsaLevel();
+    for (int size: sizes) {
+        auto a = generateMatrix(size, size);
+        auto b = generateMatrix(size, size);
+        for (int level = ISA_SCALAR; level <= detected; level++) {
+            setIsaLevel(static_cast<IsaLevel>(level));
+            Measurement m = measureTime(multiplyMatrixVinogradRows, a, b);
+            file << size << "," << isaName(static_cast<IsaLevel>(level)) << "," << m.time << "\n";
         }
     }
-
-    return c;
+    setIsaLevel(previous);
+    file.close();
 }
 
-// Оптимизированный алгоритм Винограда
-vector<vector<int>> multiplyMatrixVinogradOptimized(const vector<vector<int>> &a, const vector<vector<int>> &b) {
-    int n = a.size();
-    int m = a[0].size();       // столбцы A = строки B
-    int k = b[0].size();
-
-    vector<int> rowFactor(n, 0);
-    vector<int> colFactor(k, 0);
-    vector<vector<int>> c(n, vector<int>(k, 0));
-
-    // Предвычисление rowFactor
-    for (int i = 0; i < n; ++i)
-        for (int j = 1; j < m; j += 2)
-            rowFactor[i] += a[i][j] * a[i][j - 1];
-
-    // Предвычисление colFactor
-    for (int j = 0; j < k; ++j)
-        for (int i = 1; i < m; i += 2)
-            colFactor[j] += b[i][j] * b[i - 1][j];
-
-    bool isOdd = (m & 1);
-    int last = m - 1;
-
-    for (int i = 0; i < n; ++i) {
-        for (int j = 0; j < k; ++j) {
-            c[i][j] = -(rowFactor[i] + colFactor[j]);
-            for (int u = 1; u < m; u += 2) {
-                c[i][j] += (a[i][u - 1] + b[u][j]) * (a[i][u] + b[u - 1][j]);
+// Маленькие матрицы N x N: время на одну пару (нс) для vector-версии,
+// шаблонного multiply<N, N, N> и пакетного умножения обоими алгоритмами
+template<int N>
+void benchFixedSize(ofstream &file, int count) {
+    vector<int> a_buf(count * N * N), b_buf(count * N * N), c_buf(count * N * N);
+    for (int &x: a_buf) x = rand() % 21 - 10;
+    for (int &x: b_buf) x = rand() % 21 - 10;
+
+    vector<vector<vector<int>>> va(count, vector<vector<int>>(N, vector<int>(N)));
+    vector<vector<vector<int>>> vb = va;
+    vector<FixedMatrix<N, N>> fa(count), fb(count), fc(count);
+    for (int p = 0; p < count; p++)
+        for (int i = 0; i < N; i++)
+            for (int j = 0; j < N; j++) {
+                va[p][i][j] = fa[p](i, j) = a_buf[p * N * N + i * N + j];
+                vb[p][i][j] = fb[p](i, j) = b_buf[p * N * N + i * N + j];
             }
-            if (isOdd)
-                c[i][j] += a[i][last] * b[last][j];
-        }
-    }
 
-    return c;
-}
-
-vector<vector<int>> generateMatrix(int rows, int cols) {
-    vector<vector<int>> matrix(rows, vector<int>(cols));
-    for (auto &row: matrix) {
-        for (auto &elem: row) {
-            elem = rand() % 21 - 10; // Генерация от -10 до 10
-        }
-    }
-    return matrix;
-}
+    long long checksum = 0;
 
-template<typename Func>
-double measureTime(Func func, const vector<vector<int>> &a, const vector<vector<int>> &b) {
     auto start = high_resolution_clock::now();
-    func(a, b);
-    auto stop = high_resolution_clock::now();
-    return duration<double>(stop - start).count();
+    for (int p = 0; p < count; p++)
+        checksum += multiplyMatrixVinogradOptimized(va[p], vb[p])[0][0];
+    double tVector = duration<double, nano>(high_resolution_clock::now() - start).count() / count;
+
+    start = high_resolution_clock::now();
+    for (int p = 0; p < count; p++)
+        fc[p] = multiply(fa[p], fb[p]);
+    double tFixed = duration<double, nano>(high_resolution_clock::now() - start).count() / count;
+    checksum += fc[count - 1](0, 0);
+
+    start = high_resolution_clock::now();
+    multiplyBatch<N, N, N>(a_buf.data(), N * N, b_buf.data(), N * N, c_buf.data(), N * N, count);
+    double tBatch = duration<double, nano>(high_resolution_clock::now() - start).count() / count;
+    checksum += c_buf[0];
+
+    start = high_resolution_clock::now();
+    multiplyClassicBatch<N, N, N>(a_buf.data(), N * N, b_buf.data(), N * N, c_buf.data(), N * N, count);
+    double tClassicBatch = duration<double, nano>(high_resolution_clock::now() - start).count() / count;
+    checksum += c_buf[0];
+
+    file << N << "," << count << "," << tVector << "," << tFixed << "," << tBatch << "," << tClassicBatch << "\n";
+    cout << N << " x " << N << ": vector " << tVector << " нс, шаблон " << tFixed
+         << " нс, пакет " << tBatch << " нс (контрольная сумма " << checksum << ")" << endl;
 }
 
-void saveToCSV(const string &filename, const vector<tuple<int, string, double, double, double>> &data) {
+void saveFixedComparison(const string &filename, int count) {
     ofstream file(filename);
     if (!file.is_open()) {
         cerr << "Ошибка открытия файла: " << filename << endl;
         return;
     }
-    file << "Size,Type,Default,Winograd,Optimized_Winograd\n";
-    for (const auto &[size, type, defaultTime, winogradTime, optimizedTime]: data) {
-        file << size << "," << type << "," << defaultTime << "," << winogradTime << "," << optimizedTime << "\n";
-    }
+    file << "Size,Pairs,Optimized_Winograd_ns,Fixed_Winograd_ns,Batch_Winograd_ns,Batch_Default_ns\n";
+    benchFixedSize<4>(file, count);
+    benchFixedSize<5>(file, count);
+    benchFixedSize<8>(file, count);
+    benchFixedSize<16>(file, count);
+    benchFixedSize<17>(file, count);
+    benchFixedSize<32>(file, count);
     file.close();
 }
 
 int main() {
-    vector<tuple<int, string, double, double, double>> results;
+    vector<tuple<int, string, Measurement, Measurement, Measurement, Measurement>> results;
 
+    cout << "Набор инструкций: " << isaName(activeIsaLevel()) << endl;
     srand(static_cast<unsigned int>(time(0)));
 
     vector<int> best_sizes = {50, 100, 150, 200, 250, 300, 350, 400, 450, 500};
@@ -153,11 +159,12 @@ int main() {
         auto a = generateMatrix(size, size);
         auto b = generateMatrix(size, size);
 
-        double tDefault = measureTime(multiplyMatrixDefault, a, b);
-        double tVinograd = measureTime(multiplyMatrixVinograd, a, b);
-        double tOptimized = measureTime(multiplyMatrixVinogradOptimized, a, b);
+        Measurement tDefault = measureTime(multiplyMatrixDefault, a, b);
+        Measurement tVinograd = measureTime(multiplyMatrixVinograd, a, b);
+        Measurement tOptimized = measureTime(multiplyMatrixVinogradOptimized, a, b);
+        Measurement tRows = measureTime(multiplyMatrixVinogradRows, a, b);
 
-        results.emplace_back(size, "best", tDefault, tVinograd, tOptimized);
+        results.emplace_back(size, "best", tDefault, tVinograd, tOptimized, tRows);
     }
 
     cout << "\nНачало замеров худших случаев (нечётные размеры)" << endl;
@@ -167,16 +174,23 @@ int main() {
         auto a = generateMatrix(size, size);
         auto b = generateMatrix(size, size);
 
-        double tDefault = measureTime(multiplyMatrixDefault, a, b);
-        double tVinograd = measureTime(multiplyMatrixVinograd, a, b);
-        double tOptimized = measureTime(multiplyMatrixVinogradOptimized, a, b);
+        Measurement tDefault = measureTime(multiplyMatrixDefault, a, b);
+        Measurement tVinograd = measureTime(multiplyMatrixVinograd, a, b);
+        Measurement tOptimized = measureTime(multiplyMatrixVinogradOptimized, a, b);
+        Measurement tRows = measureTime(multiplyMatrixVinogradRows, a, b);
 
-        results.emplace_back(size, "worst", tDefault, tVinograd, tOptimized);
+        results.emplace_back(size, "worst", tDefault, tVinograd, tOptimized, tRows);
     }
 
     saveToCSV("measurements.csv", results);
 
-    cout << "\nЗамеры завершены! Результаты сохранены в measurements.csv ===" << endl;
+    cout << "\nСравнение наборов инструкций (до " << isaName(detectIsaLevel()) << ")" << endl;
+    saveIsaComparison("isa.csv", {100, 101, 300, 301, 500, 501});
+
+    cout << "\nМаленькие матрицы фиксированного размера" << endl;
+    saveFixedComparison("fixed.csv", 4000);
+
+    cout << "\nЗамеры завершены! Результаты сохранены в measurements.csv, isa.csv и fixed.csv ===" << endl;
 
     return 0;
 }
@@ -0,0 +1,202 @@
+#include "matrix.h"
+
+#include <cstdlib>
+
+#include "../common/cpu_dispatch.h"
+
+using namespace std;
+
+// Ядра по строке длины k — тело одно, варианты отличаются набором инструкций
+
+// c[j] += (a0 + x[j]) * (a1 + y[j])
+KERNEL_BODY void winogradRowBody(int *c, const int *x, const int *y, int a0, int a1, int k) {
+    for (int j = 0; j < k; ++j)
+        c[j] += (a0 + x[j]) * (a1 + y[j]);
+}
+
+// c[j] += x[j] * y[j]
+KERNEL_BODY void mulAddRowBody(int *c, const int *x, const int *y, int k) {
+    for (int j = 0; j < k; ++j)
+        c[j] += x[j] * y[j];
+}
+
+// c[j] += a * x[j]
+KERNEL_BODY void axpyRowBody(int *c, const int *x, int a, int k) {
+    for (int j = 0; j < k; ++j)
+        c[j] += a * x[j];
+}
+
+#define DEFINE_MATRIX_KERNELS(SUFFIX, TARGET)                                                       \
+    TARGET static void winogradRow##SUFFIX(int *c, const int *x, const int *y, int a0, int a1, int k) { \
+        winogradRowBody(c, x, y, a0, a1, k);                                                        \
+    }                                                                                               \
+    TARGET static void mulAddRow##SUFFIX(int *c, const int *x, const int *y, int k) {               \
+        mulAddRowBody(c, x, y, k);                                                                  \
+    }                                                                                               \
+    TARGET static void axpyRow##SUFFIX(int *c, const int *x, int a, int k) {                        \
+        axpyRowBody(c, x, a, k);                                                                    \
+    }
+
+DEFINE_MATRIX_KERNELS(Scalar, TARGET_SCALAR)
+DEFINE_MATRIX_KERNELS(Sse4, TARGET_SSE4)
+DEFINE_MATRIX_KERNELS(Avx2, TARGET_AVX2)
+DEFINE_MATRIX_KERNELS(Avx512, TARGET_AVX512)
+
+struct MatrixKernels {
+    void (*winogradRow)(int *, const int *, const int *, int, int, int);
+    void (*mulAddRow)(int *, const int *, const int *, int);
+    void (*axpyRow)(int *, const int *, int, int);
+};
+
+static const MatrixKernels MATRIX_KERNELS[ISA_LEVEL_COUNT] = {
+    {winogradRowScalar, mulAddRowScalar, axpyRowScalar},
+    {winogradRowSse4, mulAddRowSse4, axpyRowSse4},
+    {winogradRowAvx2, mulAddRowAvx2, axpyRowAvx2},
+    {winogradRowAvx512, mulAddRowAvx512, axpyRowAvx512},
+};
+
+// Функция умножения матриц — обычный алгоритм
+vector<vector<int>> multiplyMatrixDefault(const vector<vector<int>> &a, const vector<vector<int>> &b) {
+    int l = a.size();
+    int m = a[0].size();
+    int n = b[0].size();
+
+    vector<vector<int>> c(l, vector<int>(n, 0));
+
+    for (int i = 0; i < l; i++) {
+        for (int j = 0; j < n; j++) {
+            for (int r = 0; r < m; r++) {
+                c[i][j] += a[i][r] * b[r][j];
+            }
+        }
+    }
+
+    return c;
+}
+
+// Умножение матриц по алгоритму Винограда
+vector<vector<int>> multiplyMatrixVinograd(const vector<vector<int>> &a, const vector<vector<int>> &b) {
+    int n = a.size();
+    int m = a[0].size();
+    int k = b[0].size();
+
+    vector<int> rowFactor(n, 0);
+    vector<int> colFactor(k, 0);
+    vector<vector<int>> c(n, vector<int>(k, 0));
+
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < m / 2; ++j) {
+            rowFactor[i] += a[i][2 * j] * a[i][2 * j + 1];
+        }
+    }
+
+    for (int i = 0; i < k; ++i) {
+        for (int j = 0; j < m / 2; ++j) {
+            colFactor[i] += b[2 * j][i] * b[2 * j + 1][i];
+        }
+    }
+
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < k; ++j) {
+            c[i][j] = -(rowFactor[i] + colFactor[j]);
+            for (int l = 0; l < m / 2; ++l) {
+                c[i][j] += (a[i][2 * l] + b[2 * l + 1][j]) * (a[i][2 * l + 1] + b[2 * l][j]);
+            }
+        }
+    }
+
+    if (m % 2 == 1) {
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < k; ++j) {
+                c[i][j] += a[i][m - 1] * b[m - 1][j];
+            }
+        }
+    }
+
+    return c;
+}
+
+// Оптимизированный алгоритм Винограда
+vector<vector<int>> multiplyMatrixVinogradOptimized(const vector<vector<int>> &a, const vector<vector<int>> &b) {
+    int n = a.size();
+    int m = a[0].size();       // столбцы A = строки B
+    int k = b[0].size();
+
+    vector<int> rowFactor(n, 0);
+    vector<int> colFactor(k, 0);
+    vector<vector<int>> c(n, vector<int>(k, 0));
+
+    // Предвычисление rowFactor
+    for (int i = 0; i < n; ++i)
+        for (int j = 1; j < m; j += 2)
+            rowFactor[i] += a[i][j] * a[i][j - 1];
+
+    // Предвычисление colFactor
+    for (int j = 0; j < k; ++j)
+        for (int i = 1; i < m; i += 2)
+            colFactor[j] += b[i][j] * b[i - 1][j];
+
+    bool isOdd = (m & 1);
+    int last = m - 1;
+
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < k; ++j) {
+            c[i][j] = -(rowFactor[i] + colFactor[j]);
+            for (int u = 1; u < m; u += 2) {
+                c[i][j] += (a[i][u - 1] + b[u][j]) * (a[i][u] + b[u - 1][j]);
+            }
+            if (isOdd)
+                c[i][j] += a[i][last] * b[last][j];
+        }
+    }
+
+    return c;
+}
+
+// Виноград по строкам: внутренние циклы идут по строкам B
+// и выполняются ядрами под лучший доступный набор инструкций
+vector<vector<int>> multiplyMatrixVinogradRows(const vector<vector<int>> &a, const vector<vector<int>> &b) {
+    int n = a.size();
+    int m = a[0].size();       // столбцы A = строки B
+    int k = b[0].size();
+
+    const MatrixKernels &kernels = MATRIX_KERNELS[activeIsaLevel()];
+
+    vector<int> rowFactor(n, 0);
+    vector<int> colFactor(k, 0);
+    vector<vector<int>> c(n, vector<int>(k, 0));
+
+    // Предвычисление rowFactor
+    for (int i = 0; i < n; ++i)
+        for (int j = 1; j < m; j += 2)
+            rowFactor[i] += a[i][j] * a[i][j - 1];
+
+    // Предвычисление colFactor — по парам строк B
+    for (int i = 1; i < m; i += 2)
+        kernels.mulAddRow(colFactor.data(), b[i].data(), b[i - 1].data(), k);
+
+    bool isOdd = (m & 1);
+    int last = m - 1;
+
+    for (int i = 0; i < n; ++i) {
+        int *row = c[i].data();
+        for (int j = 0; j < k; ++j)
+            row[j] = -(rowFactor[i] + colFactor[j]);
+        for (int u = 1; u < m; u += 2)
+            kernels.winogradRow(row, b[u].data(), b[u - 1].data(), a[i][u - 1], a[i][u], k);
+        if (isOdd)
+            kernels.axpyRow(row, b[last].data(), a[i][last], k);
+    }
+
+    return c;
+}
+
+vector<vector<int>> generateMatrix(int rows, int cols) {
+    vector<vector<int>> matrix(rows, vector<int>(cols));
+    for (auto &row: matrix) {
+        for (auto &elem: row) {
+            elem = rand() % 21 - 10; // Генерация от -10 до 10
+        }
+    }
+    return matrix;
+}
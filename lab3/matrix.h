@@ -0,0 +1,17 @@
+#ifndef MATRIX_H
+#define MATRIX_H
+
+#include <vector>
+
+// Умножение матриц: обычный алгоритм, Виноград и оптимизированный Виноград
+std::vector<std::vector<int>> multiplyMatrixDefault(const std::vector<std::vector<int>> &a, const std::vector<std::vector<int>> &b);
+std::vector<std::vector<int>> multiplyMatrixVinograd(const std::vector<std::vector<int>> &a, const std::vector<std::vector<int>> &b);
+std::vector<std::vector<int>> multiplyMatrixVinogradOptimized(const std::vector<std::vector<int>> &a, const std::vector<std::vector<int>> &b);
+
+// Оптимизированный Виноград с проходом по строкам B ядрами SSE4/AVX2/AVX-512
+std::vector<std::vector<int>> multiplyMatrixVinogradRows(const std::vector<std::vector<int>> &a, const std::vector<std::vector<int>> &b);
+
+// Случайная матрица с элементами от -10 до 10
+std::vector<std::vector<int>> generateMatrix(int rows, int cols);
+
+#endif
@@ -3,52 +3,21 @@
 #include <cstdlib>
 #include <ctime>
 #include <limits>
+#include <climits>
 #include <sstream>
 #include <fstream>
 #include <chrono>
 
+#include "second_max.h"
+#include "../common/memory_counter.h"
+
 using namespace std;
 using namespace std::chrono;
 
-void secondMaxIterative(int &max1, int &max2) {
-    int n;
-    cin >> n;
-    while (n != 0) {
-        if (n > max1) {
-            max2 = max1;
-            max1 = n;
-        } else if (n == max1) {
-            max2 = max1;
-        } else if (n < max1 && n > max2) {
-            max2 = n;
-        }
-        cin >> n;
-    }
-}
-
-void secondMaxRecursive(int &max1, int &max2) {
-    int n;
-    cin >> n;
-    if (n == 0) {
-        return;
-    }
-
-    if (n > max1) {
-        max2 = max1;
-        max1 = n;
-    } else if (n == max1) {
-        max2 = max1;
-    } else if (n > max2) {
-        max2 = n;
-    }
-
-    secondMaxRecursive(max1, max2);
-}
-
 /*
  * анализ алгоритмов
  */
-pair<int, long long> runSecondMaxTimed(const vector<int>& data, bool recursive, int repeats = 5) {
+pair<int, long long> runSecondMaxTimed(const vector<int>& data, bool recursive, MemoryStats& memory, int repeats = 5) {
     long long total_time = 0;
     int result = -1;
 
@@ -61,12 +30,14 @@ pair<int, long long> runSecondMaxTimed(const vector<int>& data, bool recursive,
 
         int max1 = INT_MIN, max2 = INT_MIN;
 
+        startMemoryMeasure();
         auto start = chrono::high_resolution_clock::now();
         if (recursive)
             secondMaxRecursive(max1, max2);
         else
             secondMaxIterative(max1, max2);
         auto end = chrono::high_resolution_clock::now();
+        memory = stopMemoryMeasure(); // кучу считаем, стек рекурсии сюда не попадает
 
         cin.rdbuf(orig);
 
@@ -81,7 +52,8 @@ pair<int, long long> runSecondMaxTimed(const vector<int>& data, bool recursive,
 void runAllTests() {
     vector<int> sizes = {3, 30, 100, 200, 500, 1000, 2000, 5000, 10000, 50000,10000};
     ofstream csv("results.csv");
-    csv << "N,second_max_recursive,time_recursive_us,second_max_iterative,time_iterative_us\n";
+    csv << "N,second_max_recursive,time_recursive_us,recursive_bytes,recursive_allocs,recursive_peak_bytes,"
+        << "second_max_iterative,time_iterative_us,iterative_bytes,iterative_allocs,iterative_peak_bytes\n";
     csv.flush(); // сразу пишем заголовок
 
     srand(43); // фиксированный сид
@@ -92,11 +64,15 @@ void runAllTests() {
             testData.push_back((rand() << 15) | rand());
         testData.push_back(0); // конец
 
-        pair<int, long long> rec = runSecondMaxTimed(testData, true);
+        MemoryStats rec_mem, iter_mem;
+        pair<int, long long> rec = runSecondMaxTimed(testData, true, rec_mem);
 
-        auto iter = runSecondMaxTimed(testData, false);
+        auto iter = runSecondMaxTimed(testData, false, iter_mem);
 
-        csv << N << "," << rec.first << "," << rec.second << "," << iter.first << "," << iter.second << "\n";
+        csv << N << "," << rec.first << "," << rec.second << ","
+            << rec_mem.allocated_bytes << "," << rec_mem.allocations << "," << rec_mem.peak_bytes << ","
+            << iter.first << "," << iter.second << ","
+            << iter_mem.allocated_bytes << "," << iter_mem.allocations << "," << iter_mem.peak_bytes << "\n";
         csv.flush(); 
 
         cout << "N = " << N << " записано\n";
@@ -0,0 +1,40 @@
+#include "second_max.h"
+
+#include <iostream>
+
+using namespace std;
+
+void secondMaxIterative(int &max1, int &max2) {
+    int n;
+    cin >> n;
+    while (n != 0) {
+        if (n > max1) {
+            max2 = max1;
+            max1 = n;
+        } else if (n == max1) {
+            max2 = max1;
+        } else if (n < max1 && n > max2) {
+            max2 = n;
+        }
+        cin >> n;
+    }
+}
+
+void secondMaxRecursive(int &max1, int &max2) {
+    int n;
+    cin >> n;
+    if (n == 0) {
+        return;
+    }
+
+    if (n > max1) {
+        max2 = max1;
+        max1 = n;
+    } else if (n == max1) {
+        max2 = max1;
+    } else if (n > max2) {
+        max2 = n;
+    }
+
+    secondMaxRecursive(max1, max2);
+}
@@ -0,0 +1,9 @@
+#ifndef SECOND_MAX_H
+#define SECOND_MAX_H
+
+// Второй максимум последовательности из cin, оканчивающейся нулём:
+// итеративно и рекурсивно. max1/max2 — начальные значения и результат
+void secondMaxIterative(int &max1, int &max2);
+void secondMaxRecursive(int &max1, int &max2);
+
+#endif
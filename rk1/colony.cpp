@@ -0,0 +1,955 @@
+#include "colony.h"
+
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <queue>
+#include <chrono>
+#include <deque>
+
+#include "../common/cpu_dispatch.h"
+
+using namespace std;
+using namespace std::chrono;
+
+const int OR_OPT_MAX_SEGMENT = 3;
+
+// создаём матрицу расстояний
+vector<vector<int>> generateGraph(int num_cities) {
+    vector<vector<int>> graph;
+    for (int i = 0; i < num_cities; i++) {
+        vector<int> row;
+        for (int j = 0; j < num_cities; j++) {
+            row.push_back(0);
+        }
+        graph.push_back(row);
+    }
+
+    for (int i = 0; i < num_cities; i++) {
+        for (int j = i + 1; j < num_cities; j++) {
+            int distance = rand() % 15 + 1;
+            graph[i][j] = distance;
+            graph[j][i] = distance;
+        }
+    }
+    return graph;
+}
+
+// создаём случайные города на плоскости 1000 x 1000
+vector<City> generateCities(int num_cities) {
+    vector<City> cities(num_cities);
+    for (int i = 0; i < num_cities; i++) {
+        cities[i].x = rand() % 1000;
+        cities[i].y = rand() % 1000;
+    }
+    return cities;
+}
+
+// матрица евклидовых расстояний, округлённых до целого (как EUC_2D в TSPLIB)
+vector<vector<int>> buildEuclideanGraph(const vector<City>& cities) {
+    int n = cities.size();
+    vector<vector<int>> graph(n, vector<int>(n, 0));
+    for (int i = 0; i < n; i++) {
+        for (int j = i + 1; j < n; j++) {
+            double dx = cities[i].x - cities[j].x;
+            double dy = cities[i].y - cities[j].y;
+            int distance = (int) (sqrt(dx * dx + dy * dy) + 0.5);
+            graph[i][j] = distance;
+            graph[j][i] = distance;
+        }
+    }
+    return graph;
+}
+
+// создаём матрицу феромонов
+vector<vector<double>> initializePheromones(int num_cities, double value) {
+    vector<vector<double>> pheromones;
+    for (int i = 0; i < num_cities; i++) {
+        vector<double> row;
+        for (int j = 0; j < num_cities; j++) {
+            row.push_back(value);
+        }
+        pheromones.push_back(row);
+    }
+    return pheromones;
+}
+
+// считаем Q как среднее расстояние между городами
+double calculateQ(const vector<vector<int>>& graph) {
+    int n = graph.size();
+    double sum_distance = 0;
+    int num_roads = 0;
+    for (int i = 0; i < n; i++) {
+        for (int j = i + 1; j < n; j++) {
+            sum_distance += graph[i][j];
+            num_roads++;
+        }
+    }
+    return sum_distance / num_roads;
+}
+
+double edgeAttractiveness(int distance, double beta) {
+    // совпадающие города (расстояние 0) считаем очень близкими
+    return pow(1.0 / (distance > 0 ? distance : 0.1), beta);
+}
+
+// привлекательность дороги eta^beta считаем один раз, а не на каждом шаге муравья
+vector<vector<double>> calculateAttractiveness(const vector<vector<int>>& graph, double beta) {
+    int n = graph.size();
+    vector<vector<double>> attractiveness(n, vector<double>(n, 0.0));
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            if (i == j) continue;
+            attractiveness[i][j] = edgeAttractiveness(graph[i][j], beta);
+        }
+    }
+    return attractiveness;
+}
+
+/*
+ * k-d дерево по координатам городов: поиск k ближайших соседей
+ * за O(log n) в среднем вместо просмотра всех городов
+ */
+struct KdTree {
+    struct Node {
+        int city;
+        int left;
+        int right;
+        int axis;
+    };
+
+    const vector<City>* cities;
+    vector<Node> nodes;
+    int root;
+
+    explicit KdTree(const vector<City>& points) : cities(&points) {
+        vector<int> ids(points.size());
+        for (int i = 0; i < (int) ids.size(); i++) ids[i] = i;
+        nodes.reserve(points.size());
+        root = build(ids, 0, ids.size(), 0);
+    }
+
+    double coord(int city, int axis) const {
+        return axis == 0 ? (*cities)[city].x : (*cities)[city].y;
+    }
+
+    int build(vector<int>& ids, int from, int to, int depth) {
+        if (from >= to) return -1;
+        int axis = depth % 2;
+        int mid = (from + to) / 2;
+        nth_element(ids.begin() + from, ids.begin() + mid, ids.begin() + to,
+                    [&](int a, int b) { return coord(a, axis) < coord(b, axis); });
+
+        int index = nodes.size();
+        nodes.push_back({ids[mid], -1, -1, axis});
+        int left = build(ids, from, mid, depth + 1);
+        int right = build(ids, mid + 1, to, depth + 1);
+        nodes[index].left = left;
+        nodes[index].right = right;
+        return index;
+    }
+
+    // k ближайших к городу query (сам город не включается), по возрастанию расстояния
+    vector<int> nearest(int query, int k) const {
+        if (k <= 0) return {};
+        priority_queue<pair<double, int>> heap; // максимум сверху — самый дальний из найденных
+        search(root, query, k, heap);
+
+        vector<int> result(heap.size());
+        for (int i = (int) result.size() - 1; i >= 0; i--) {
+            result[i] = heap.top().second;
+            heap.pop();
+        }
+        return result;
+    }
+
+    void search(int node, int query, int k, priority_queue<pair<double, int>>& heap) const {
+        if (node < 0) return;
+        const Node& cur = nodes[node];
+
+        if (cur.city != query) {
+            double dx = (*cities)[cur.city].x - (*cities)[query].x;
+            double dy = (*cities)[cur.city].y - (*cities)[query].y;
+            double dist = dx * dx + dy * dy;
+            if ((int) heap.size() < k) {
+                heap.push(make_pair(dist, cur.city));
+            } else if (!heap.empty() && dist < heap.top().first) {
+                heap.pop();
+                heap.push(make_pair(dist, cur.city));
+            }
+        }
+
+        double diff = coord(query, cur.axis) - coord(cur.city, cur.axis);
+        int near_side = diff < 0 ? cur.left : cur.right;
+        int far_side = diff < 0 ? cur.right : cur.left;
+
+        search(near_side, query, k, heap);
+        // в дальнюю половину идём, только если там может быть кто-то ближе
+        if ((int) heap.size() < k || (!heap.empty() && diff * diff < heap.top().first)) {
+            search(far_side, query, k, heap);
+        }
+    }
+};
+
+// списки кандидатов по матрице расстояний: O(n^2 log k), годится для любых графов
+vector<int> buildCandidateRow(const vector<vector<int>>& graph, int city, int k) {
+    int n = graph.size();
+    k = max(0, min(k, n - 1));
+    vector<int> others;
+    for (int j = 0; j < n; j++) {
+        if (j != city) others.push_back(j);
+    }
+    partial_sort(others.begin(), others.begin() + k, others.end(),
+                 [&](int a, int b) { return graph[city][a] < graph[city][b]; });
+    others.resize(k);
+    return others;
+}
+
+vector<vector<int>> buildCandidateLists(const vector<vector<int>>& graph, int k) {
+    int n = graph.size();
+    vector<vector<int>> candidates(n);
+    for (int i = 0; i < n; i++) {
+        candidates[i] = buildCandidateRow(graph, i, k);
+    }
+    return candidates;
+}
+
+// списки кандидатов для евклидовых задач через k-d дерево: O(n k log n)
+vector<vector<int>> buildCandidateLists(const vector<City>& cities, int k) {
+    int n = cities.size();
+    k = min(k, n - 1);
+    if (k <= 0) return vector<vector<int>>(n);
+    KdTree tree(cities);
+    vector<vector<int>> candidates(n);
+    for (int i = 0; i < n; i++) {
+        candidates[i] = tree.nearest(i, k);
+    }
+    return candidates;
+}
+
+// лучший из оставшихся городов — запасной вариант, когда все кандидаты уже посещены
+int chooseBestRemaining(int current_city, const vector<bool>& visited, const vector<vector<double>>& pher, const vector<vector<double>>& attractiveness, double alpha) {
+    int n = visited.size();
+    int best_city = -1;
+    double best_value = -1;
+    for (int i = 0; i < n; i++) {
+        if (!visited[i]) {
+            double value = pow(pher[current_city][i], alpha) * attractiveness[current_city][i];
+            if (value > best_value) {
+                best_value = value;
+                best_city = i;
+            }
+        }
+    }
+    return best_city;
+}
+
+// выбираем следующий город для муравья среди ближайших непосещённых соседей
+int chooseNextCity(int current_city, const vector<bool>& visited, const vector<vector<double>>& pher, const vector<vector<double>>& attractiveness, const vector<vector<int>>& candidates, const ColonyParams& params) {
+    vector<pair<int, double>> probs;
+    double total = 0;
+    int best_city = -1;
+    double best_prob = -1;
+
+    for (int i : candidates[current_city]) {
+        if (!visited[i]) {
+            double tau = pow(pher[current_city][i], params.alpha);
+            double eta = attractiveness[current_city][i];
+            double prob = tau * eta;
+            probs.push_back(make_pair(i, prob));
+            total += prob;
+            if (prob > best_prob) {
+                best_prob = prob;
+                best_city = i;
+            }
+        }
+    }
+
+    if (probs.empty()) {
+        return chooseBestRemaining(current_city, visited, pher, attractiveness, params.alpha);
+    }
+
+    // ACS: с вероятностью q0 берём лучший город, иначе — обычная рулетка
+    if (params.mode == ANT_COLONY && (double)rand() / RAND_MAX < params.q0) {
+        return best_city;
+    }
+
+    if (total == 0) {
+        return probs[rand() % probs.size()].first;
+    }
+
+    double rand_val = (double)rand() / RAND_MAX;
+    double cumulative = 0;
+
+    for (int i = 0; i < probs.size(); i++) {
+        cumulative += probs[i].second / total;
+        if (rand_val <= cumulative) {
+            return probs[i].first;
+        }
+    }
+
+    return probs[probs.size() - 1].first;
+}
+
+// один муравей проходит все города из start_city и возвращается обратно
+double buildAntPath(int start_city, const vector<vector<double>>& pher, const vector<vector<double>>& attractiveness, const vector<vector<int>>& candidates, const vector<vector<int>>& graph, const ColonyParams& params, vector<int>& path) {
+    int n = graph.size();
+    int current_city = start_city;
+
+    vector<bool> visited(n, false);
+    visited[current_city] = true;
+    path.clear();
+    path.push_back(current_city);
+    double path_length = 0;
+
+    for (int step = 1; step < n; step++) {
+        int next_city = chooseNextCity(current_city, visited, pher, attractiveness, candidates, params);
+        path_length += graph[current_city][next_city];
+        visited[next_city] = true;
+        path.push_back(next_city);
+        current_city = next_city;
+    }
+
+    path_length += graph[current_city][start_city];
+    path.push_back(start_city);
+    return path_length;
+}
+
+// откладываем феромон по пройденному пути
+void depositPheromone(vector<vector<double>>& pher, const vector<int>& path, double d_pher) {
+    for (int i = 0; i < path.size() - 1; i++) {
+        int from = path[i];
+        int to = path[i + 1];
+        pher[from][to] += d_pher;
+        pher[to][from] += d_pher;
+    }
+}
+
+// испарение одной строки матрицы феромонов — ядро с вариантами под наборы инструкций
+KERNEL_BODY void evaporateRowBody(double* row, int n, double factor, double min_pher) {
+    for (int j = 0; j < n; j++) {
+        double value = row[j] * factor;
+        row[j] = value < min_pher ? min_pher : value;
+    }
+}
+
+TARGET_SCALAR static void evaporateRowScalar(double* row, int n, double factor, double min_pher) {
+    evaporateRowBody(row, n, factor, min_pher);
+}
+
+TARGET_SSE4 static void evaporateRowSse4(double* row, int n, double factor, double min_pher) {
+    evaporateRowBody(row, n, factor, min_pher);
+}
+
+TARGET_AVX2 static void evaporateRowAvx2(double* row, int n, double factor, double min_pher) {
+    evaporateRowBody(row, n, factor, min_pher);
+}
+
+TARGET_AVX512 static void evaporateRowAvx512(double* row, int n, double factor, double min_pher) {
+    evaporateRowBody(row, n, factor, min_pher);
+}
+
+typedef void (*EvaporateRowKernel)(double*, int, double, double);
+
+static const EvaporateRowKernel EVAPORATE_ROW[ISA_LEVEL_COUNT] = {
+    evaporateRowScalar, evaporateRowSse4, evaporateRowAvx2, evaporateRowAvx512
+};
+
+// испарение феромона в конце дня
+void evaporatePheromone(vector<vector<double>>& pher, double ro, double min_pher) {
+    EvaporateRowKernel kernel = EVAPORATE_ROW[activeIsaLevel()];
+    int n = pher.size();
+    for (int i = 0; i < n; i++) {
+        kernel(pher[i].data(), n, 1.0 - ro, min_pher);
+    }
+}
+
+// ACS: испарение и отложение только на рёбрах пути, остальные рёбра не трогаем
+void updatePathPheromone(vector<vector<double>>& pher, const vector<int>& path, double rate, double value) {
+    for (int i = 0; i < path.size() - 1; i++) {
+        int from = path[i];
+        int to = path[i + 1];
+        pher[from][to] = (1.0 - rate) * pher[from][to] + rate * value;
+        pher[to][from] = pher[from][to];
+    }
+}
+
+// длина замкнутого пути (последний город совпадает с первым)
+double calculatePathLength(const vector<int>& path, const vector<vector<int>>& graph) {
+    double length = 0;
+    for (int i = 0; i < path.size() - 1; i++) {
+        length += graph[path[i]][path[i + 1]];
+    }
+    return length;
+}
+
+int nextInTour(const vector<int>& tour, const vector<int>& pos, int city) {
+    return tour[(pos[city] + 1) % tour.size()];
+}
+
+int prevInTour(const vector<int>& tour, const vector<int>& pos, int city) {
+    int n = tour.size();
+    return tour[(pos[city] - 1 + n) % n];
+}
+
+// разворот участка тура с позиции i по позицию j включительно (по кругу)
+void reverseSegment(vector<int>& tour, vector<int>& pos, int i, int j) {
+    int n = tour.size();
+    int len = (j - i + n) % n + 1;
+    // разворот дополнения даёт тот же цикл, поэтому разворачиваем более короткую часть
+    if (2 * len > n) {
+        int new_i = (j + 1) % n;
+        int new_j = (i - 1 + n) % n;
+        i = new_i;
+        j = new_j;
+        len = n - len;
+    }
+    for (int s = 0; s < len / 2; s++) {
+        int a = tour[i];
+        int b = tour[j];
+        tour[i] = b;
+        pos[b] = i;
+        tour[j] = a;
+        pos[a] = j;
+        i = (i + 1) % n;
+        j = (j - 1 + n) % n;
+    }
+}
+
+/*
+ * 2-opt: убираем ребро (a, b) и ребро (c, d), добавляем (a, c) и (b, d).
+ * c берём только из списка кандидатов a, и только пока g[a][c] < g[a][b]
+ */
+bool tryTwoOpt(int a, vector<int>& tour, vector<int>& pos, const vector<vector<int>>& graph, const vector<vector<int>>& candidates, vector<int>& touched) {
+    for (int dir = 0; dir < 2; dir++) {
+        int b = dir == 0 ? nextInTour(tour, pos, a) : prevInTour(tour, pos, a);
+        int d_ab = graph[a][b];
+
+        for (int c : candidates[a]) {
+            int d_ac = graph[a][c];
+            if (d_ac >= d_ab) break;
+
+            int d = dir == 0 ? nextInTour(tour, pos, c) : prevInTour(tour, pos, c);
+            if (c == b || d == a) continue;
+
+            int delta = d_ac + graph[b][d] - d_ab - graph[c][d];
+            if (delta < 0) {
+                if (dir == 0) {
+                    reverseSegment(tour, pos, pos[b], pos[c]);
+                } else {
+                    reverseSegment(tour, pos, pos[c], pos[b]);
+                }
+                touched = {a, b, c, d};
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/*
+ * переносим участок из len городов, начиная с s1, сразу после города left.
+ * Тур по кругу: участок S, затем B (до left включительно), затем C (до s1).
+ * Нужен цикл B, S, C — сдвигаем на len позиций более короткий из B и C,
+ * так что переписываются только города между участком и местом вставки
+ */
+void moveSegment(vector<int>& tour, vector<int>& pos, int s1, int len, int left, bool reversed) {
+    int n = tour.size();
+    int i = pos[s1];
+    int segment[OR_OPT_MAX_SEGMENT];
+    for (int t = 0; t < len; t++) {
+        segment[t] = tour[(i + t) % n];
+    }
+    if (reversed) {
+        reverse(segment, segment + len);
+    }
+
+    int b_len = (pos[left] - (i + len - 1) + n) % n;
+    int c_len = n - len - b_len;
+    int to;
+    if (b_len <= c_len) {
+        // B сдвигается назад на место участка, участок встаёт после B
+        for (int t = 0; t < b_len; t++) {
+            int city = tour[(i + len + t) % n];
+            tour[(i + t) % n] = city;
+            pos[city] = (i + t) % n;
+        }
+        to = (i + b_len) % n;
+    } else {
+        // C сдвигается вперёд на место участка, участок встаёт перед C
+        int c_start = (i + len + b_len) % n;
+        for (int t = c_len - 1; t >= 0; t--) {
+            int city = tour[(c_start + t) % n];
+            tour[(c_start + t + len) % n] = city;
+            pos[city] = (c_start + t + len) % n;
+        }
+        to = c_start;
+    }
+    for (int t = 0; t < len; t++) {
+        tour[(to + t) % n] = segment[t];
+        pos[segment[t]] = (to + t) % n;
+    }
+}
+
+/*
+ * Or-opt: вырезаем участок из 1..OR_OPT_MAX_SEGMENT городов, начинающийся в s1,
+ * и вставляем его рядом с одним из ближайших соседей его концов
+ */
+bool tryOrOpt(int s1, vector<int>& tour, vector<int>& pos, const vector<vector<int>>& graph, const vector<vector<int>>& candidates, vector<int>& touched) {
+    int n = tour.size();
+
+    for (int len = 1; len <= OR_OPT_MAX_SEGMENT && len + 3 <= n; len++) {
+        int s2 = tour[(pos[s1] + len - 1) % n];
+        int p = prevInTour(tour, pos, s1);
+        int nx = nextInTour(tour, pos, s2);
+        int removed = graph[p][s1] + graph[s2][nx] - graph[p][nx];
+        if (removed <= 0) continue;
+
+        auto inSegment = [&](int city) {
+            return (pos[city] - pos[s1] + n) % n < len;
+        };
+
+        // end — конец участка, который встанет рядом с c; other — второй конец
+        for (int side = 0; side < 2; side++) {
+            int end = side == 0 ? s1 : s2;
+            int other = side == 0 ? s2 : s1;
+
+            for (int c : candidates[end]) {
+                if (graph[end][c] >= removed) break;
+                if (inSegment(c)) continue;
+
+                // вставка между c и следующим за ним: c, end ... other, e
+                int e = nextInTour(tour, pos, c);
+                if (!inSegment(e)) {
+                    int added = graph[c][end] + graph[other][e] - graph[c][e];
+                    if (added < removed) {
+                        moveSegment(tour, pos, s1, len, c, end != s1);
+                        touched = {p, nx, s1, s2, c, e};
+                        return true;
+                    }
+                }
+
+                // вставка между предыдущим и c: f, other ... end, c
+                int f = prevInTour(tour, pos, c);
+                if (!inSegment(f)) {
+                    int added = graph[f][other] + graph[end][c] - graph[f][c];
+                    if (added < removed) {
+                        moveSegment(tour, pos, s1, len, f, end == s1);
+                        touched = {p, nx, s1, s2, f, c};
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+    return false;
+}
+
+/*
+ * улучшаем путь муравья 2-opt и Or-opt с битами "не смотреть":
+ * город проверяется снова, только если рядом с ним поменялись рёбра
+ */
+double localSearch(vector<int>& path, const vector<vector<int>>& graph, const vector<vector<int>>& candidates) {
+    int n = graph.size();
+    if (n < 5) {
+        return calculatePathLength(path, graph);
+    }
+
+    int start_city = path[0];
+    vector<int> tour(path.begin(), path.end() - 1);
+    vector<int> pos(n);
+    for (int i = 0; i < n; i++) {
+        pos[tour[i]] = i;
+    }
+
+    deque<int> queue(tour.begin(), tour.end());
+    vector<bool> active(n, true);
+    vector<int> touched;
+
+    while (!queue.empty()) {
+        int a = queue.front();
+        queue.pop_front();
+        active[a] = false;
+
+        if (tryTwoOpt(a, tour, pos, graph, candidates, touched) ||
+            tryOrOpt(a, tour, pos, graph, candidates, touched)) {
+            for (int city : touched) {
+                if (!active[city]) {
+                    active[city] = true;
+                    queue.push_back(city);
+                }
+            }
+        }
+    }
+
+    // путь снова начинаем и заканчиваем в исходном городе
+    path.clear();
+    for (int i = 0; i < n; i++) {
+        path.push_back(tour[(pos[start_city] + i) % n]);
+    }
+    path.push_back(start_city);
+    return calculatePathLength(path, graph);
+}
+
+// длина пути жадного муравья (всегда в ближайший непосещённый город)
+double nearestNeighbourLength(const vector<vector<int>>& graph, const vector<vector<int>>& candidates) {
+    int n = graph.size();
+    vector<bool> visited(n, false);
+    int current_city = 0;
+    visited[current_city] = true;
+    double length = 0;
+
+    for (int step = 1; step < n; step++) {
+        int next_city = -1;
+        // кандидаты отсортированы по расстоянию — первый непосещённый и есть ближайший
+        for (int i : candidates[current_city]) {
+            if (!visited[i]) {
+                next_city = i;
+                break;
+            }
+        }
+        if (next_city < 0) {
+            for (int i = 0; i < n; i++) {
+                if (!visited[i] && (next_city < 0 || graph[current_city][i] < graph[current_city][next_city])) {
+                    next_city = i;
+                }
+            }
+        }
+        length += graph[current_city][next_city];
+        visited[next_city] = true;
+        current_city = next_city;
+    }
+    return length + graph[current_city][0];
+}
+
+// начальный уровень феромона: 1 для базовой системы, по жадному пути для MMAS и ACS
+double initialPheromoneLevel(const vector<vector<int>>& graph, const vector<vector<int>>& candidates, const ColonyParams& params) {
+    if (params.mode == ANT_SYSTEM) {
+        return 1.0;
+    }
+    double Q = calculateQ(graph);
+    double nn_length = nearestNeighbourLength(graph, candidates);
+    if (params.mode == MAX_MIN) {
+        return Q / (params.ro * nn_length);
+    }
+    return Q / (graph.size() * nn_length);
+}
+
+// MMAS: нижняя граница феромона по верхней (Stützle, Hoos)
+double calculateTauMin(double tau_max, int num_cities, double p_best) {
+    double p = pow(p_best, 1.0 / num_cities);
+    double avg = num_cities / 2.0;
+    if (avg <= 1.0) {
+        return tau_max;
+    }
+    return min(tau_max, tau_max * (1.0 - p) / ((avg - 1.0) * p));
+}
+
+void printPath(const vector<int>& path) {
+    for (int i = 0; i < path.size(); i++) {
+        cout << path[i] << " ";
+    }
+}
+
+/*
+ * запуск колонии в выбранном режиме.
+ * Пустая матрица феромонов заполняется начальным уровнем для этого режима
+ */
+ColonyResult runColony(const vector<vector<int>>& graph, const vector<vector<double>>& attractiveness, const vector<vector<int>>& candidates, const ColonyParams& params, vector<vector<double>>& pher, bool verbose, const vector<int>& initial_best) {
+    int n = graph.size();
+    double Q = calculateQ(graph);
+    double tau0 = initialPheromoneLevel(graph, candidates, params);
+    if (pher.empty()) {
+        pher = initializePheromones(n, tau0);
+    }
+
+    ColonyResult result;
+    result.best_length = numeric_limits<double>::max();
+    result.days = 0;
+    result.restarts = 0;
+
+    // тёплый старт: лучший путь прошлого запуска сразу считается найденным
+    if (!initial_best.empty()) {
+        result.best_path = initial_best;
+        result.best_length = calculatePathLength(initial_best, graph);
+    }
+
+    int stale_days = 0;
+    int since_restart = 0;
+    vector<int> path;
+    auto start = high_resolution_clock::now();
+
+    for (int day = 0; day < params.num_days; day++) {
+        vector<int> day_best_path;
+        double day_best_length = numeric_limits<double>::max();
+
+        for (int ant = 0; ant < params.num_ants; ant++) {
+            double path_length = buildAntPath(ant % n, pher, attractiveness, candidates, graph, params, path);
+            if (params.local_search) {
+                path_length = localSearch(path, graph, candidates);
+            }
+
+            if (params.mode == ANT_SYSTEM) {
+                depositPheromone(pher, path, Q / path_length);
+            } else if (params.mode == ANT_COLONY) {
+                // локальное обновление: пройденные рёбра теряют привлекательность для следующих муравьёв
+                updatePathPheromone(pher, path, params.xi, tau0);
+            }
+
+            if (path_length < day_best_length) {
+                day_best_length = path_length;
+                day_best_path = path;
+            }
+
+            if (verbose) {
+                cout << "\nОбщая длина: " << path_length << endl;
+                cout << "Пройденный путь: ";
+                printPath(path);
+                cout << endl;
+            }
+        }
+
+        if (day_best_length < result.best_length) {
+            result.best_length = day_best_length;
+            result.best_path = day_best_path;
+            stale_days = 0;
+            since_restart = 0;
+        } else {
+            stale_days++;
+            since_restart++;
+        }
+
+        if (params.mode == ANT_SYSTEM) {
+            evaporatePheromone(pher, params.ro, params.min_pher);
+        } else if (params.mode == MAX_MIN) {
+            double tau_max = Q / (params.ro * result.best_length);
+            double tau_min = calculateTauMin(tau_max, n, params.p_best);
+
+            if (params.restart_after > 0 && since_restart >= params.restart_after) {
+                // застой: начинаем заново с tau_max на всех рёбрах
+                pher = initializePheromones(n, tau_max);
+                since_restart = 0;
+                result.restarts++;
+            } else {
+                evaporatePheromone(pher, params.ro, tau_min);
+
+                // изредка кладёт глобально лучший путь, в остальные дни — лучший за день
+                bool use_global = params.global_best_every > 0 && (day + 1) % params.global_best_every == 0;
+                const vector<int>& deposit_path = use_global ? result.best_path : day_best_path;
+                double deposit_length = use_global ? result.best_length : day_best_length;
+                depositPheromone(pher, deposit_path, Q / deposit_length);
+
+                for (int i = 0; i < (int) deposit_path.size() - 1; i++) {
+                    int from = deposit_path[i];
+                    int to = deposit_path[i + 1];
+                    pher[from][to] = min(pher[from][to], tau_max);
+                    pher[to][from] = pher[from][to];
+                }
+            }
+        } else {
+            // ACS: глобальное обновление только по лучшему пути
+            updatePathPheromone(pher, result.best_path, params.ro, Q / result.best_length);
+        }
+
+        result.days = day + 1;
+        result.best_by_day.push_back(result.best_length);
+        result.ms_by_day.push_back(duration<double, milli>(high_resolution_clock::now() - start).count());
+        if (params.stop_after > 0 && stale_days >= params.stop_after) {
+            break;
+        }
+    }
+
+    return result;
+}
+
+/*
+ * динамический режим: колония живёт между запусками, а граф меняется понемногу.
+ * Феромон и лучший путь сохраняются, пересчитываются только затронутые строки
+ */
+ColonyState createColonyState(const vector<vector<int>>& graph, const vector<vector<int>>& candidates, const ColonyParams& params) {
+    ColonyState state;
+    state.params = params;
+    state.graph = graph;
+    state.attractiveness = calculateAttractiveness(graph, params.beta);
+    state.candidates = candidates;
+
+    // обновления считают, что в каждом списке ровно min(num_candidates, n - 1) городов:
+    // списки другого размера строим заново
+    int k = max(0, min(params.num_candidates, (int) graph.size() - 1));
+    for (int i = 0; i < (int) graph.size(); i++) {
+        if ((int) state.candidates[i].size() != k) {
+            state.candidates[i] = buildCandidateRow(graph, i, params.num_candidates);
+        }
+    }
+    state.initial_pher = initialPheromoneLevel(graph, candidates, params);
+    state.pher = initializePheromones(graph.size(), state.initial_pher);
+    state.best_length = numeric_limits<double>::max();
+    return state;
+}
+
+ColonyResult runColony(ColonyState& state, bool verbose) {
+    ColonyResult result = runColony(state.graph, state.attractiveness, state.candidates, state.params, state.pher, verbose, state.best_path);
+    state.best_path = result.best_path;
+    state.best_length = result.best_length;
+    return result;
+}
+
+// феромон на рёбрах города частично возвращаем к начальному уровню — старый опыт о нём устарел
+void resetCityPheromone(ColonyState& state, int city) {
+    int n = state.graph.size();
+    double strength = state.params.reset_strength;
+    for (int j = 0; j < n; j++) {
+        double value = (1.0 - strength) * state.pher[city][j] + strength * state.initial_pher;
+        state.pher[city][j] = value;
+        state.pher[j][city] = value;
+    }
+}
+
+// город city стал ближе к other или дальше от него: правим его список кандидатов
+void refreshCandidate(ColonyState& state, int city, int other) {
+    vector<int>& row = state.candidates[city];
+    const vector<int>& distances = state.graph[city];
+    int k = min(state.params.num_candidates, (int) state.graph.size() - 1);
+
+    auto found = find(row.begin(), row.end(), other);
+    if (found == row.end()) {
+        if ((int) row.size() == k && !row.empty() && distances[row.back()] <= distances[other]) {
+            return; // other как был, так и остался за пределами списка
+        }
+    } else {
+        row.erase(found);
+        if ((int) row.size() + 1 == k && (row.empty() || distances[other] >= distances[row.back()])) {
+            // other стал последним: кто-то снаружи списка может оказаться ближе
+            row = buildCandidateRow(state.graph, city, state.params.num_candidates);
+            return;
+        }
+    }
+    auto position = upper_bound(row.begin(), row.end(), other,
+                                [&](int a, int b) { return distances[a] < distances[b]; });
+    row.insert(position, other);
+    if ((int) row.size() > k) {
+        row.pop_back();
+    }
+}
+
+void updateEdgeWeight(ColonyState& state, int from, int to, int weight) {
+    int n = state.graph.size();
+    if (from < 0 || from >= n || to < 0 || to >= n || from == to) {
+        cerr << "updateEdgeWeight: нет ребра " << from << " - " << to << endl;
+        return;
+    }
+    state.graph[from][to] = weight;
+    state.graph[to][from] = weight;
+
+    double attractiveness = edgeAttractiveness(weight, state.params.beta);
+    state.attractiveness[from][to] = attractiveness;
+    state.attractiveness[to][from] = attractiveness;
+
+    refreshCandidate(state, from, to);
+    refreshCandidate(state, to, from);
+
+    resetCityPheromone(state, from);
+    resetCityPheromone(state, to);
+    state.pher[from][to] = state.initial_pher;
+    state.pher[to][from] = state.initial_pher;
+
+    if (!state.best_path.empty()) {
+        state.best_length = calculatePathLength(state.best_path, state.graph);
+    }
+}
+
+int insertCity(ColonyState& state, const vector<int>& distances) {
+    int city = state.graph.size();
+    if ((int) distances.size() != city) {
+        cerr << "insertCity: ожидается " << city << " расстояний, передано " << distances.size() << endl;
+        return -1;
+    }
+    int n = city + 1;
+
+    for (int i = 0; i < city; i++) {
+        state.graph[i].push_back(distances[i]);
+        state.attractiveness[i].push_back(edgeAttractiveness(distances[i], state.params.beta));
+        state.pher[i].push_back(state.initial_pher);
+    }
+    state.graph.push_back(distances);
+    state.graph[city].push_back(0);
+    state.attractiveness.push_back(vector<double>(n, 0.0));
+    for (int j = 0; j < city; j++) {
+        state.attractiveness[city][j] = state.attractiveness[j][city];
+    }
+    state.pher.push_back(vector<double>(n, state.initial_pher));
+
+    // у старых городов новый сосед попадает в список, только если он ближе последнего кандидата
+    state.candidates.push_back(buildCandidateRow(state.graph, city, state.params.num_candidates));
+    for (int i = 0; i < city; i++) {
+        refreshCandidate(state, i, city);
+    }
+
+    // в лучший путь вставляем новый город туда, где он удлиняет путь меньше всего
+    if (!state.best_path.empty()) {
+        int best_position = 1;
+        int best_increase = numeric_limits<int>::max();
+        for (int i = 0; i + 1 < (int) state.best_path.size(); i++) {
+            int a = state.best_path[i];
+            int b = state.best_path[i + 1];
+            int increase = state.graph[a][city] + state.graph[city][b] - state.graph[a][b];
+            if (increase < best_increase) {
+                best_increase = increase;
+                best_position = i + 1;
+            }
+        }
+        state.best_path.insert(state.best_path.begin() + best_position, city);
+        state.best_length = calculatePathLength(state.best_path, state.graph);
+    }
+    return city;
+}
+
+void removeCity(ColonyState& state, int city) {
+    int n = state.graph.size();
+    if (city < 0 || city >= n) {
+        cerr << "removeCity: нет города " << city << endl;
+        return;
+    }
+
+    state.graph.erase(state.graph.begin() + city);
+    state.attractiveness.erase(state.attractiveness.begin() + city);
+    state.pher.erase(state.pher.begin() + city);
+    state.candidates.erase(state.candidates.begin() + city);
+    for (int i = 0; i < n - 1; i++) {
+        state.graph[i].erase(state.graph[i].begin() + city);
+        state.attractiveness[i].erase(state.attractiveness[i].begin() + city);
+        state.pher[i].erase(state.pher[i].begin() + city);
+    }
+
+    // номера после city сдвигаются; списки, где был city, строим заново
+    for (int i = 0; i < n - 1; i++) {
+        vector<int>& row = state.candidates[i];
+        if (find(row.begin(), row.end(), city) != row.end()) {
+            row = buildCandidateRow(state.graph, i, state.params.num_candidates);
+            continue;
+        }
+        for (int& other : row) {
+            if (other > city) other--;
+        }
+    }
+
+    // из лучшего пути город просто выбрасываем, соседи соединяются напрямую
+    if (!state.best_path.empty()) {
+        vector<int> tour;
+        for (int i = 0; i + 1 < (int) state.best_path.size(); i++) {
+            int other = state.best_path[i];
+            if (other != city) tour.push_back(other > city ? other - 1 : other);
+        }
+        if (tour.empty()) {
+            // удалили последний город — пути больше нет
+            state.best_path.clear();
+            state.best_length = numeric_limits<double>::max();
+            return;
+        }
+        tour.push_back(tour[0]);
+        state.best_path = tour;
+        state.best_length = calculatePathLength(state.best_path, state.graph);
+    }
+}
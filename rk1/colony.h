@@ -0,0 +1,115 @@
+#ifndef COLONY_H
+#define COLONY_H
+
+#include <vector>
+
+// вариант муравьиного алгоритма
+enum ColonyMode {
+    ANT_SYSTEM,      // базовая система: феромон кладут все муравьи
+    MAX_MIN,         // MMAS: кладёт только лучший, феромон в границах [tau_min, tau_max]
+    ANT_COLONY       // ACS: псевдослучайное правило выбора и локальное обновление
+};
+
+/*
+ * параметры колонии; значения по умолчанию совпадают с прежними константами.
+ * Задаются из командной строки (--ключ=значение) или из файла (ключ = значение)
+ */
+struct ColonyParams {
+    ColonyMode mode = ANT_SYSTEM;
+    int num_cities = 10;
+    int num_ants = 3;
+    int num_days = 2;
+
+    double alpha = 0.01;
+    double beta = 1.0;
+    double ro = 0.5;
+    double min_pher = 0.001;
+
+    // размер списка кандидатов (ближайших соседей) для каждого города
+    int num_candidates = 5;
+    // локальный поиск 2-opt / Or-opt после построения каждого пути
+    bool local_search = true;
+
+    // ACS: вероятность жадного выбора и сила локального обновления
+    double q0 = 0.9;
+    double xi = 0.1;
+
+    // MMAS: вероятность построить лучший путь при сходимости (для tau_min),
+    // как часто кладёт глобально лучший вместо лучшего за день, через сколько дней без улучшений сбрасывать феромон
+    double p_best = 0.05;
+    int global_best_every = 5;
+    int restart_after = 20;
+
+    // динамический режим: насколько феромон на рёбрах изменённого города возвращается к начальному
+    double reset_strength = 0.5;
+
+    // остановка, если лучший путь не улучшался столько дней подряд (0 — не останавливаться)
+    int stop_after = 0;
+    unsigned int seed = 0;
+};
+
+// координаты города для евклидовых задач
+struct City {
+    double x;
+    double y;
+};
+
+struct ColonyResult {
+    std::vector<int> best_path;
+    double best_length;
+    int days;       // сколько дней прошло до остановки
+    int restarts;   // сколько раз MMAS сбрасывал феромон
+    std::vector<double> best_by_day;     // лучшая длина на конец каждого дня
+    std::vector<double> ms_by_day;       // время от старта на конец каждого дня
+};
+
+// графы и начальные данные
+std::vector<std::vector<int>> generateGraph(int num_cities);
+std::vector<City> generateCities(int num_cities);
+std::vector<std::vector<int>> buildEuclideanGraph(const std::vector<City>& cities);
+std::vector<std::vector<double>> initializePheromones(int num_cities, double value = 1.0);
+double calculateQ(const std::vector<std::vector<int>>& graph);
+std::vector<std::vector<double>> calculateAttractiveness(const std::vector<std::vector<int>>& graph, double beta);
+
+// списки k ближайших соседей: по матрице или k-d деревом по координатам
+std::vector<std::vector<int>> buildCandidateLists(const std::vector<std::vector<int>>& graph, int k);
+std::vector<std::vector<int>> buildCandidateLists(const std::vector<City>& cities, int k);
+
+// построение пути и феромон
+double buildAntPath(int start_city, const std::vector<std::vector<double>>& pher, const std::vector<std::vector<double>>& attractiveness, const std::vector<std::vector<int>>& candidates, const std::vector<std::vector<int>>& graph, const ColonyParams& params, std::vector<int>& path);
+void depositPheromone(std::vector<std::vector<double>>& pher, const std::vector<int>& path, double d_pher);
+void evaporatePheromone(std::vector<std::vector<double>>& pher, double ro, double min_pher);
+
+// локальный поиск 2-opt / Or-opt
+double calculatePathLength(const std::vector<int>& path, const std::vector<std::vector<int>>& graph);
+double localSearch(std::vector<int>& path, const std::vector<std::vector<int>>& graph, const std::vector<std::vector<int>>& candidates);
+
+void printPath(const std::vector<int>& path);
+ColonyResult runColony(const std::vector<std::vector<int>>& graph, const std::vector<std::vector<double>>& attractiveness, const std::vector<std::vector<int>>& candidates, const ColonyParams& params, std::vector<std::vector<double>>& pher, bool verbose, const std::vector<int>& initial_best = {});
+
+// колония, которая переживает изменения графа между запусками
+struct ColonyState {
+    ColonyParams params;
+    std::vector<std::vector<int>> graph;
+    std::vector<std::vector<double>> attractiveness;
+    std::vector<std::vector<int>> candidates;
+    std::vector<std::vector<double>> pher;
+    double initial_pher;                // начальный уровень феромона для этого режима
+    std::vector<int> best_path;         // пусто до первого запуска
+    double best_length;
+};
+
+double edgeAttractiveness(int distance, double beta);
+std::vector<int> buildCandidateRow(const std::vector<std::vector<int>>& graph, int city, int k);
+
+ColonyState createColonyState(const std::vector<std::vector<int>>& graph, const std::vector<std::vector<int>>& candidates, const ColonyParams& params);
+
+// продолжить колонию: феромон сохраняется, лучший путь прошлого запуска — тёплый старт
+ColonyResult runColony(ColonyState& state, bool verbose);
+
+// изменения графа: правятся только строки затронутых городов
+void updateEdgeWeight(ColonyState& state, int from, int to, int weight);
+int insertCity(ColonyState& state, const std::vector<int>& distances);  // номер нового города или -1
+void removeCity(ColonyState& state, int city);                         // номера после city сдвигаются на 1
+
+#endif
@@ -2,181 +2,527 @@
 #include <vector>
 #include <cstdlib>
 #include <ctime>
-#include <cmath>
 #include <limits>
+#include <algorithm>
+#include <string>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <cmath>
+
+#include "colony.h"
+#include "tsplib.h"
+#include "../common/memory_counter.h"
 
 using namespace std;
+using namespace std::chrono;
 
-const int NUM_CITIES = 10;
-const int NUM_ANTS = 3;
-const int NUM_DAYS = 2;
+// папка с задачами TSPLIB по умолчанию; сборка подставляет путь к rk1/tsplib в исходниках
+#ifndef TSPLIB_DIR
+#define TSPLIB_DIR "tsplib"
+#endif
 
-const double ALPHA = 0.01;
-const double BETA = 1.0;
-const double RO = 0.5;
-const double MIN_PHER = 0.001;
+// колонки памяти одного замера: выделено байт, число выделений, пик живой памяти
+void writeMemory(ofstream& csv, const MemoryStats& mem) {
+    csv << mem.allocated_bytes << "," << mem.allocations << "," << mem.peak_bytes;
+}
 
-// создаём матрицу расстояний
-vector<vector<int>> generateGraph() {
-    vector<vector<int>> graph;
-    for (int i = 0; i < NUM_CITIES; i++) {
-        vector<int> row;
-        for (int j = 0; j < NUM_CITIES; j++) {
-            row.push_back(0);
-        }
-        graph.push_back(row);
-    }
+/*
+ * замеры: время одного дня (итерации) и качество пути в зависимости от k
+ */
+void runCandidateBenchmark() {
+    const vector<int> sizes = {200, 1000, 2000};
+    const vector<int> ks = {5, 10, 15, 20, 30};
+    const int bench_ants = 10;
+    const int bench_days = 5;
+
+    ofstream csv("candidates.csv");
+    csv << "Cities,K,BuildMs,IterMs,BestLength,Bytes,Allocs,PeakBytes\n";
+
+    for (int n : sizes) {
+        srand(42);
+        vector<City> cities = generateCities(n);
+        vector<vector<int>> graph = buildEuclideanGraph(cities);
+        ColonyParams params;
+        vector<vector<double>> attractiveness = calculateAttractiveness(graph, params.beta);
+        double Q = calculateQ(graph);
+
+        vector<int> ks_full = ks;
+        ks_full.push_back(n - 1); // k = n - 1 — полный перебор, как было раньше
+
+        for (int k : ks_full) {
+            auto build_start = high_resolution_clock::now();
+            vector<vector<int>> candidates = buildCandidateLists(cities, k);
+            auto build_stop = high_resolution_clock::now();
+            double build_ms = duration<double, milli>(build_stop - build_start).count();
 
-    for (int i = 0; i < NUM_CITIES; i++) {
-        for (int j = i + 1; j < NUM_CITIES; j++) {
-            int distance = rand() % 15 + 1;
-            graph[i][j] = distance;
-            graph[j][i] = distance;
+            srand(7);
+            startMemoryMeasure();
+            vector<vector<double>> pher = initializePheromones(n);
+            double best_length = numeric_limits<double>::max();
+            vector<int> path;
+
+            auto start = high_resolution_clock::now();
+            for (int day = 0; day < bench_days; day++) {
+                for (int ant = 0; ant < bench_ants; ant++) {
+                    double path_length = buildAntPath(ant % n, pher, attractiveness, candidates, graph, params, path);
+                    depositPheromone(pher, path, Q / path_length);
+                    best_length = min(best_length, path_length);
+                }
+                evaporatePheromone(pher, params.ro, params.min_pher);
+            }
+            auto stop = high_resolution_clock::now();
+            double iter_ms = duration<double, milli>(stop - start).count() / bench_days;
+            MemoryStats memory = stopMemoryMeasure();
+
+            csv << n << "," << k << "," << build_ms << "," << iter_ms << "," << best_length << ",";
+            writeMemory(csv, memory);
+            csv << "\n";
+            cout << "n = " << n << ", k = " << k << ": " << iter_ms << " мс/день, лучший путь " << best_length << endl;
         }
     }
-    return graph;
+
+    csv.close();
+    cout << "\nРезультаты сохранены в candidates.csv" << endl;
 }
 
-// создаём матрицу феромонов
-vector<vector<double>> initializePheromones() {
-    vector<vector<double>> pheromones;
-    for (int i = 0; i < NUM_CITIES; i++) {
-        vector<double> row;
-        for (int j = 0; j < NUM_CITIES; j++) {
-            row.push_back(1.0);
+/*
+ * замеры: сколько дней и миллисекунд нужно, чтобы дойти до целевого качества,
+ * с локальным поиском и без него. Цель — лучший найденный путь + 5%
+ */
+void runLocalSearchBenchmark() {
+    const vector<int> sizes = {200, 1000};
+    const int bench_ants = 10;
+    const int bench_days = 30;
+    const double target_gap = 0.05;
+
+    ofstream csv("localsearch.csv");
+    csv << "Cities,LocalSearch,Days,TotalMs,BestLength,Target,DaysToTarget,MsToTarget,Bytes,Allocs,PeakBytes\n";
+
+    for (int n : sizes) {
+        srand(42);
+        vector<City> cities = generateCities(n);
+        vector<vector<int>> graph = buildEuclideanGraph(cities);
+        ColonyParams params;
+        vector<vector<double>> attractiveness = calculateAttractiveness(graph, params.beta);
+        vector<vector<int>> candidates = buildCandidateLists(cities, 10);
+        double Q = calculateQ(graph);
+
+        // для каждого режима: лучший путь и время на конец каждого дня
+        vector<vector<double>> best_by_day(2), ms_by_day(2);
+        vector<MemoryStats> memory(2);
+
+        for (int mode = 0; mode < 2; mode++) {
+            bool use_local_search = mode == 1;
+            srand(7);
+            startMemoryMeasure();
+            vector<vector<double>> pher = initializePheromones(n);
+            double best_length = numeric_limits<double>::max();
+            vector<int> path;
+
+            auto start = high_resolution_clock::now();
+            for (int day = 0; day < bench_days; day++) {
+                for (int ant = 0; ant < bench_ants; ant++) {
+                    double path_length = buildAntPath(ant % n, pher, attractiveness, candidates, graph, params, path);
+                    if (use_local_search) {
+                        path_length = localSearch(path, graph, candidates);
+                    }
+                    depositPheromone(pher, path, Q / path_length);
+                    best_length = min(best_length, path_length);
+                }
+                evaporatePheromone(pher, params.ro, params.min_pher);
+
+                best_by_day[mode].push_back(best_length);
+                ms_by_day[mode].push_back(duration<double, milli>(high_resolution_clock::now() - start).count());
+            }
+            memory[mode] = stopMemoryMeasure();
+        }
+
+        double target = min(best_by_day[0].back(), best_by_day[1].back()) * (1.0 + target_gap);
+
+        for (int mode = 0; mode < 2; mode++) {
+            string days_to_target = "N/A";
+            string ms_to_target = "N/A";
+            for (int day = 0; day < bench_days; day++) {
+                if (best_by_day[mode][day] <= target) {
+                    days_to_target = to_string(day + 1);
+                    ms_to_target = to_string(ms_by_day[mode][day]);
+                    break;
+                }
+            }
+
+            csv << n << "," << (mode == 1 ? "on" : "off") << "," << bench_days << ","
+                << ms_by_day[mode].back() << "," << best_by_day[mode].back() << "," << target << ","
+                << days_to_target << "," << ms_to_target << ",";
+            writeMemory(csv, memory[mode]);
+            csv << "\n";
+            cout << "n = " << n << ", локальный поиск " << (mode == 1 ? "вкл" : "выкл")
+                 << ": лучший путь " << best_by_day[mode].back()
+                 << ", дней до цели " << days_to_target << ", мс до цели " << ms_to_target << endl;
         }
-        pheromones.push_back(row);
     }
-    return pheromones;
+
+    csv.close();
+    cout << "\nРезультаты сохранены в localsearch.csv" << endl;
 }
 
-// считаем Q как среднее расстояние между городами
-double calculateQ(const vector<vector<int>>& graph) {
-    double sum_distance = 0;
-    int num_roads = 0;
-    for (int i = 0; i < NUM_CITIES; i++) {
-        for (int j = i + 1; j < NUM_CITIES; j++) {
-            sum_distance += graph[i][j];
-            num_roads++;
+/*
+ * замеры на задачах TSPLIB с известным оптимумом: лучшее и среднее отклонение
+ * от оптимума, время до цели (оптимум + 5%) и дней в секунду.
+ * Файлы <имя>.tsp берутся из локальной папки, отсутствующие пропускаются
+ */
+void runTsplibBenchmark(const string& dir, const ColonyParams& params) {
+    const vector<string> names = {"explicit9", "ulysses16", "bayg29", "att48", "eil51", "berlin52",
+                                  "circle100", "kroA100", "a280", "pr1002"};
+    const int bench_runs = 5;
+    const double target_gap = 0.05;
+
+    ofstream csv("tsplib.csv");
+    csv << "Instance,Cities,Optimum,Runs,BestGap%,MeanGap%,RunsToTarget,MeanMsToTarget,DaysPerSec,Bytes,Allocs,PeakBytes\n";
+
+    for (const string& name : names) {
+        string filename = dir + "/" + name + ".tsp";
+        if (!ifstream(filename).good()) {
+            cout << name << ": нет файла " << filename << ", пропускаем" << endl;
+            continue;
         }
+
+        TspInstance instance;
+        if (!loadTsplib(filename, instance)) continue;
+
+        int n = instance.graph.size();
+        double optimum = TSPLIB_OPTIMA.at(name);
+        double target = optimum * (1.0 + target_gap);
+        vector<vector<double>> attractiveness = calculateAttractiveness(instance.graph, params.beta);
+        vector<vector<int>> candidates = instance.euclidean
+                                         ? buildCandidateLists(instance.cities, params.num_candidates)
+                                         : buildCandidateLists(instance.graph, params.num_candidates);
+
+        double best_gap = numeric_limits<double>::max();
+        double sum_gap = 0, sum_ms_to_target = 0, total_days = 0, total_ms = 0;
+        int runs_to_target = 0;
+        MemoryStats memory; // память — последнего прогона, прогоны устроены одинаково
+
+        for (int run = 0; run < bench_runs; run++) {
+            srand(params.seed + run + 1);
+            startMemoryMeasure();
+            ColonyResult result;
+            {
+                vector<vector<double>> pher;
+                result = runColony(instance.graph, attractiveness, candidates, params, pher, false);
+            }
+            memory = stopMemoryMeasure();
+
+            double gap = (result.best_length - optimum) / optimum * 100.0;
+            best_gap = min(best_gap, gap);
+            sum_gap += gap;
+            total_days += result.days;
+            if (result.days > 0) {
+                total_ms += result.ms_by_day.back();
+            }
+
+            for (int day = 0; day < result.days; day++) {
+                if (result.best_by_day[day] <= target) {
+                    sum_ms_to_target += result.ms_by_day[day];
+                    runs_to_target++;
+                    break;
+                }
+            }
+        }
+
+        string ms_to_target = runs_to_target > 0 ? to_string(sum_ms_to_target / runs_to_target) : "N/A";
+        double days_per_sec = total_ms > 0 ? total_days / (total_ms / 1000.0) : 0;
+
+        csv << name << "," << n << "," << optimum << "," << bench_runs << ","
+            << best_gap << "," << sum_gap / bench_runs << "," << runs_to_target << ","
+            << ms_to_target << "," << days_per_sec << ",";
+        writeMemory(csv, memory);
+        csv << "\n";
+        cout << name << " (" << n << " городов): лучшее отклонение " << best_gap
+             << "%, среднее " << sum_gap / bench_runs << "%, до цели " << ms_to_target
+             << " мс, дней/с " << days_per_sec << endl;
     }
-    return sum_distance / num_roads;
+
+    csv.close();
+    cout << "\nРезультаты сохранены в tsplib.csv" << endl;
 }
 
-// выбираем следующий город для муравья
-int chooseNextCity(int current_city, const vector<bool>& visited, const vector<vector<double>>& pher, const vector<vector<int>>& graph) {
-    vector<pair<int, double>> probs;
-    double total = 0;
-
-    for (int i = 0; i < NUM_CITIES; i++) {
-        if (!visited[i]) {
-            double tau = pow(pher[current_city][i], ALPHA);
-            double eta = pow(1.0 / graph[current_city][i], BETA);
-            double prob = tau * eta;
-            probs.push_back(make_pair(i, prob));
-            total += prob;
+// дни и мс до цели; ms_offset — время подготовки, которое тоже засчитываем
+void findTarget(const ColonyResult& result, double target, double ms_offset, string& days, string& ms) {
+    days = "N/A";
+    ms = "N/A";
+    for (int day = 0; day < result.days; day++) {
+        if (result.best_by_day[day] <= target) {
+            days = to_string(day + 1);
+            ms = to_string(ms_offset + result.ms_by_day[day]);
+            return;
         }
     }
+}
 
-    if (total == 0) {
-        vector<int> candidates;
-        for (int i = 0; i < NUM_CITIES; i++) {
-            if (!visited[i]) {
-                candidates.push_back(i);
+/*
+ * динамический режим: граф немного меняется, и колония либо продолжает работу
+ * с сохранённым феромоном (тёплый старт), либо запускается заново (холодный старт)
+ */
+void runDynamicBenchmark(const ColonyParams& params) {
+    const int n = 300;
+    const int changed_cities = n / 20;  // 5% городов
+    const double target_gap = 0.02;
+    const vector<string> scenarios = {"edges", "insert", "remove"};
+
+    ofstream csv("dynamic.csv");
+    csv << "Scenario,Cities,UpdateMs,WarmDaysToTarget,WarmMsToTarget,ColdSetupMs,ColdDaysToTarget,ColdMsToTarget,Target,"
+        << "WarmBytes,WarmAllocs,WarmPeakBytes,ColdBytes,ColdAllocs,ColdPeakBytes\n";
+
+    for (const string& scenario : scenarios) {
+        srand(42);
+        vector<City> cities = generateCities(n);
+        vector<vector<int>> graph = buildEuclideanGraph(cities);
+        ColonyState state = createColonyState(graph, buildCandidateLists(cities, params.num_candidates), params);
+        srand(params.seed + 1);
+        runColony(state, false);
+
+        // изменение графа, замеряем только само обновление состояния; память — вместе с тёплым запуском
+        srand(7);
+        startMemoryMeasure();
+        auto start = high_resolution_clock::now();
+        for (int step = 0; step < changed_cities; step++) {
+            if (scenario == "edges") {
+                int from = rand() % state.graph.size();
+                int to = state.candidates[from][rand() % state.candidates[from].size()];
+                double factor = 0.7 + 0.6 * rand() / RAND_MAX;
+                updateEdgeWeight(state, from, to, max(1, (int) (state.graph[from][to] * factor + 0.5)));
+            } else if (scenario == "insert") {
+                City city;
+                city.x = rand() % 1000;
+                city.y = rand() % 1000;
+                vector<int> distances;
+                for (const City& other : cities) {
+                    double dx = city.x - other.x;
+                    double dy = city.y - other.y;
+                    distances.push_back((int) (sqrt(dx * dx + dy * dy) + 0.5));
+                }
+                cities.push_back(city);
+                insertCity(state, distances);
+            } else {
+                int city = rand() % state.graph.size();
+                cities.erase(cities.begin() + city);
+                removeCity(state, city);
             }
         }
-        return candidates[rand() % candidates.size()];
-    }
+        double update_ms = duration<double, milli>(high_resolution_clock::now() - start).count();
 
-    double rand_val = (double)rand() / RAND_MAX;
-    double cumulative = 0;
+        srand(params.seed + 2);
+        ColonyResult warm = runColony(state, false);
+        MemoryStats warm_memory = stopMemoryMeasure();
 
-    for (int i = 0; i < probs.size(); i++) {
-        cumulative += probs[i].second / total;
-        if (rand_val <= cumulative) {
-            return probs[i].first;
+        // холодный старт: всё строим заново по изменённому графу
+        startMemoryMeasure();
+        ColonyResult cold;
+        double setup_ms;
+        {
+            start = high_resolution_clock::now();
+            ColonyState cold_state = createColonyState(state.graph, buildCandidateLists(state.graph, params.num_candidates), params);
+            setup_ms = duration<double, milli>(high_resolution_clock::now() - start).count();
+            srand(params.seed + 2);
+            cold = runColony(cold_state, false);
         }
+        MemoryStats cold_memory = stopMemoryMeasure();
+
+        double target = min(warm.best_length, cold.best_length) * (1.0 + target_gap);
+        string warm_days, warm_ms, cold_days, cold_ms;
+        findTarget(warm, target, update_ms, warm_days, warm_ms);
+        findTarget(cold, target, setup_ms, cold_days, cold_ms);
+
+        csv << scenario << "," << state.graph.size() << "," << update_ms << "," << warm_days << "," << warm_ms << ","
+            << setup_ms << "," << cold_days << "," << cold_ms << "," << target << ",";
+        writeMemory(csv, warm_memory);
+        csv << ",";
+        writeMemory(csv, cold_memory);
+        csv << "\n";
+        cout << scenario << ": обновление " << update_ms << " мс; тёплый старт — дней до цели " << warm_days
+             << ", мс " << warm_ms << "; холодный — дней " << cold_days << ", мс " << cold_ms << endl;
     }
 
-    return probs[probs.size() - 1].first;
+    csv.close();
+    cout << "\nРезультаты сохранены в dynamic.csv" << endl;
 }
 
-int main() {
-    srand(time(0));
+// применяем один параметр; false — если ключ неизвестен или значение некорректно
+bool setParam(ColonyParams& params, const string& key, const string& value) {
+    stringstream in(value);
+    if (key == "mode") {
+        if (value == "as") params.mode = ANT_SYSTEM;
+        else if (value == "mmas") params.mode = MAX_MIN;
+        else if (value == "acs") params.mode = ANT_COLONY;
+        else return false;
+        return true;
+    }
+
+    if (key == "cities") in >> params.num_cities;
+    else if (key == "ants") in >> params.num_ants;
+    else if (key == "days") in >> params.num_days;
+    else if (key == "alpha") in >> params.alpha;
+    else if (key == "beta") in >> params.beta;
+    else if (key == "ro") in >> params.ro;
+    else if (key == "min-pher") in >> params.min_pher;
+    else if (key == "candidates") in >> params.num_candidates;
+    else if (key == "local-search") in >> params.local_search;
+    else if (key == "q0") in >> params.q0;
+    else if (key == "xi") in >> params.xi;
+    else if (key == "p-best") in >> params.p_best;
+    else if (key == "global-best-every") in >> params.global_best_every;
+    else if (key == "restart-after") in >> params.restart_after;
+    else if (key == "reset-strength") in >> params.reset_strength;
+    else if (key == "stop-after") in >> params.stop_after;
+    else if (key == "seed") in >> params.seed;
+    else return false;
+
+    if (in.fail()) return false;
 
-    vector<vector<int>> graph = generateGraph();
-    vector<vector<double>> pher = initializePheromones();
-    double Q = calculateQ(graph);
+    // значения, при которых алгоритм падает или уходит в inf
+    if (key == "cities") return params.num_cities >= 3;
+    if (key == "ants") return params.num_ants >= 1;
+    if (key == "days") return params.num_days >= 1;
+    if (key == "ro") return params.ro > 0 && params.ro <= 1;
+    if (key == "candidates") return params.num_candidates >= 1;
+    if (key == "q0") return params.q0 >= 0 && params.q0 <= 1;
+    if (key == "xi") return params.xi >= 0 && params.xi <= 1;
+    if (key == "p-best") return params.p_best > 0 && params.p_best < 1;
+    if (key == "reset-strength") return params.reset_strength >= 0 && params.reset_strength <= 1;
+    return true;
+}
+
+// файл параметров: строки "ключ = значение", после # — комментарий
+bool loadConfig(const string& filename, ColonyParams& params) {
+    ifstream file(filename);
+    if (!file.is_open()) {
+        cerr << "Ошибка открытия файла: " << filename << endl;
+        return false;
+    }
+
+    string line;
+    int line_number = 0;
+    while (getline(file, line)) {
+        line_number++;
+        line = line.substr(0, line.find('#'));
+        size_t eq = line.find('=');
+        if (eq == string::npos) {
+            if (line.find_first_not_of(" \t\r") != string::npos) {
+                cerr << filename << ":" << line_number << ": ожидается ключ = значение" << endl;
+                return false;
+            }
+            continue;
+        }
 
-    cout << "Матрица смежности:\n";
-    for (int i = 0; i < NUM_CITIES; i++) {
-        for (int j = 0; j < NUM_CITIES; j++) {
-            cout << graph[i][j] << " ";
+        string key, value;
+        stringstream(line.substr(0, eq)) >> key;
+        stringstream(line.substr(eq + 1)) >> value;
+        if (!setParam(params, key, value)) {
+            cerr << filename << ":" << line_number << ": некорректный параметр " << key << endl;
+            return false;
         }
-        cout << endl;
     }
+    return true;
+}
 
-    vector<int> best_path;
-    double best_length = numeric_limits<double>::max();
+/*
+ * разбор командной строки: [команда] [--config=файл] [--tsp=путь] [--ключ=значение ...] [--no-ls].
+ * --tsp — файл задачи TSPLIB (для tsp-bench — папка с файлами)
+ * Параметры применяются слева направо, поэтому после --config их можно переопределить
+ */
+bool parseArguments(int argc, char* argv[], ColonyParams& params, string& command, string& tsplib_path) {
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg.rfind("--", 0) != 0) {
+            command = arg;
+            continue;
+        }
+        if (arg == "--no-ls") {
+            params.local_search = false;
+            continue;
+        }
 
-    for (int day = 0; day < NUM_DAYS; day++) {
-        for (int ant = 0; ant < NUM_ANTS; ant++) {
-            int start_city = 0;
-            int current_city = start_city;
+        size_t eq = arg.find('=');
+        string key = arg.substr(2, eq == string::npos ? string::npos : eq - 2);
+        string value = eq == string::npos ? "" : arg.substr(eq + 1);
 
-            vector<bool> visited(NUM_CITIES, false);
-            visited[current_city] = true;
-            vector<int> path;
-            path.push_back(current_city);
-            double path_length = 0;
-
-            for (int step = 1; step < NUM_CITIES; step++) {
-                int next_city = chooseNextCity(current_city, visited, pher, graph);
-                path_length += graph[current_city][next_city];
-                visited[next_city] = true;
-                path.push_back(next_city);
-                current_city = next_city;
-            }
+        if (key == "config") {
+            if (!loadConfig(value, params)) return false;
+        } else if (key == "tsp") {
+            tsplib_path = value;
+        } else if (!setParam(params, key, value)) {
+            cerr << "Некорректный параметр: " << arg << endl;
+            return false;
+        }
+    }
+    return true;
+}
 
-            path_length += graph[current_city][start_city];
-            path.push_back(start_city);
+int main(int argc, char* argv[]) {
+    ColonyParams params;
+    string command;
+    string tsplib_path;
+    if (!parseArguments(argc, argv, params, command, tsplib_path)) {
+        return 1;
+    }
 
-            double d_pher = Q / path_length;
-            for (int i = 0; i < path.size() - 1; i++) {
-                int from = path[i];
-                int to = path[i + 1];
-                pher[from][to] += d_pher;
-                pher[to][from] += d_pher;
-            }
+    if (command == "bench") {
+        runCandidateBenchmark();
+        return 0;
+    }
+    if (command == "ls-bench") {
+        runLocalSearchBenchmark();
+        return 0;
+    }
+    if (command == "tsp-bench") {
+        runTsplibBenchmark(tsplib_path.empty() ? TSPLIB_DIR : tsplib_path, params);
+        return 0;
+    }
+    if (command == "dyn-bench") {
+        runDynamicBenchmark(params);
+        return 0;
+    }
 
-            if (path_length < best_length) {
-                best_length = path_length;
-                best_path = path;
-            }
+    srand(params.seed != 0 ? params.seed : time(0));
 
-            cout << "\nОбщая длина: " << path_length << endl;
-            cout << "Пройденный путь: ";
-            for (int i = 0; i < path.size(); i++) {
-                cout << path[i] << " ";
-            }
-            cout << endl;
+    vector<vector<int>> graph;
+    vector<vector<int>> candidates;
+    if (!tsplib_path.empty()) {
+        TspInstance instance;
+        if (!loadTsplib(tsplib_path, instance)) {
+            return 1;
         }
+        graph = instance.graph;
+        candidates = instance.euclidean
+                     ? buildCandidateLists(instance.cities, params.num_candidates)
+                     : buildCandidateLists(graph, params.num_candidates);
+        cout << "Задача " << instance.name << ", городов: " << graph.size() << endl;
+    } else {
+        graph = generateGraph(params.num_cities);
+        candidates = buildCandidateLists(graph, params.num_candidates);
 
-        for (int i = 0; i < NUM_CITIES; i++) {
-            for (int j = 0; j < NUM_CITIES; j++) {
-                pher[i][j] *= (1.0 - RO);
-                if (pher[i][j] < MIN_PHER) {
-                    pher[i][j] = MIN_PHER;
-                }
+        cout << "Матрица смежности:\n";
+        for (int i = 0; i < params.num_cities; i++) {
+            for (int j = 0; j < params.num_cities; j++) {
+                cout << graph[i][j] << " ";
             }
+            cout << endl;
         }
     }
+    vector<vector<double>> attractiveness = calculateAttractiveness(graph, params.beta);
+
+    vector<vector<double>> pher;
+    ColonyResult result = runColony(graph, attractiveness, candidates, params, pher, tsplib_path.empty());
 
     cout << "\nЛучший путь: ";
-    for (int i = 0; i < best_path.size(); i++) {
-        cout << best_path[i] << " ";
+    printPath(result.best_path);
+    cout << "\nЕго длина: " << result.best_length << endl;
+    cout << "Дней: " << result.days;
+    if (params.mode == MAX_MIN) {
+        cout << ", сбросов феромона: " << result.restarts;
     }
-    cout << "\nЕго длина: " << best_length << endl;
+    cout << endl;
 
     return 0;
 }
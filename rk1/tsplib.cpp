@@ -0,0 +1,170 @@
+#include "tsplib.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cmath>
+
+using namespace std;
+
+const map<string, double> TSPLIB_OPTIMA = {
+    {"ulysses16", 6859}, {"gr17", 2085}, {"ulysses22", 7013}, {"bayg29", 1610},
+    {"att48", 10628}, {"eil51", 426}, {"berlin52", 7542}, {"st70", 675},
+    {"eil76", 538}, {"kroA100", 21282}, {"a280", 2579}, {"lin318", 42029},
+    {"rat783", 8806}, {"pr1002", 259045},
+    // синтетические задачи из rk1/tsplib, оптимум указан в COMMENT файла
+    {"explicit9", 270}, {"circle100", 62800}
+};
+
+int tsplibDistance(const City& a, const City& b, const string& type) {
+    double dx = a.x - b.x;
+    double dy = a.y - b.y;
+
+    if (type == "ATT") {
+        double r = sqrt((dx * dx + dy * dy) / 10.0);
+        int t = (int) (r + 0.5);
+        return t < r ? t + 1 : t;
+    }
+    if (type == "CEIL_2D") {
+        return (int) ceil(sqrt(dx * dx + dy * dy));
+    }
+    if (type == "GEO") {
+        // координаты в формате ГГ.ММ, расстояние по сфере в километрах
+        const double PI = 3.141592;
+        const double RRR = 6378.388;
+        auto toRadians = [&](double value) {
+            int deg = (int) value;
+            double min = value - deg;
+            return PI * (deg + 5.0 * min / 3.0) / 180.0;
+        };
+        double lat_a = toRadians(a.x), lon_a = toRadians(a.y);
+        double lat_b = toRadians(b.x), lon_b = toRadians(b.y);
+        double q1 = cos(lon_a - lon_b);
+        double q2 = cos(lat_a - lat_b);
+        double q3 = cos(lat_a + lat_b);
+        return (int) (RRR * acos(0.5 * ((1.0 + q1) * q2 - (1.0 - q1) * q3)) + 1.0);
+    }
+    return (int) (sqrt(dx * dx + dy * dy) + 0.5);
+}
+
+bool loadTsplib(const string& filename, TspInstance& instance) {
+    ifstream file(filename);
+    if (!file.is_open()) {
+        cerr << "Ошибка открытия файла: " << filename << endl;
+        return false;
+    }
+
+    int dimension = 0;
+    string weight_type, weight_format = "FULL_MATRIX";
+    string line;
+    string section;
+
+    // заголовок: строки "КЛЮЧ : ЗНАЧЕНИЕ" до начала секции данных
+    while (getline(file, line)) {
+        size_t colon = line.find(':');
+        string key, value;
+        stringstream(line.substr(0, colon)) >> key;
+        if (colon != string::npos) {
+            value = line.substr(colon + 1);
+            value.erase(0, value.find_first_not_of(" \t"));
+            value.erase(value.find_last_not_of(" \t\r") + 1);
+        }
+
+        if (key == "NAME") instance.name = value;
+        else if (key == "TYPE" && value != "TSP") {
+            cerr << filename << ": поддерживается только TYPE : TSP" << endl;
+            return false;
+        }
+        else if (key == "DIMENSION") {
+            stringstream in(value);
+            if (!(in >> dimension)) {
+                cerr << filename << ": некорректный DIMENSION: " << value << endl;
+                return false;
+            }
+        }
+        else if (key == "EDGE_WEIGHT_TYPE") weight_type = value;
+        else if (key == "EDGE_WEIGHT_FORMAT") weight_format = value;
+        else if (key == "NODE_COORD_SECTION" || key == "EDGE_WEIGHT_SECTION") {
+            section = key;
+            break;
+        }
+    }
+
+    if (dimension <= 1 || section.empty()) {
+        cerr << filename << ": нет DIMENSION или секции данных" << endl;
+        return false;
+    }
+
+    int n = dimension;
+    instance.graph.assign(n, vector<int>(n, 0));
+    instance.cities.clear();
+
+    if (weight_type == "EXPLICIT") {
+        if (section != "EDGE_WEIGHT_SECTION") {
+            cerr << filename << ": для EXPLICIT нужна EDGE_WEIGHT_SECTION" << endl;
+            return false;
+        }
+
+        // перечисляем клетки матрицы в порядке, в котором они записаны в файле
+        vector<pair<int, int>> cells;
+        for (int i = 0; i < n; i++) {
+            if (weight_format == "FULL_MATRIX") {
+                for (int j = 0; j < n; j++) cells.push_back(make_pair(i, j));
+            } else if (weight_format == "UPPER_ROW") {
+                for (int j = i + 1; j < n; j++) cells.push_back(make_pair(i, j));
+            } else if (weight_format == "UPPER_DIAG_ROW") {
+                for (int j = i; j < n; j++) cells.push_back(make_pair(i, j));
+            } else if (weight_format == "LOWER_DIAG_ROW") {
+                for (int j = 0; j <= i; j++) cells.push_back(make_pair(i, j));
+            } else {
+                cerr << filename << ": неподдерживаемый EDGE_WEIGHT_FORMAT " << weight_format << endl;
+                return false;
+            }
+        }
+
+        for (const auto& cell : cells) {
+            int weight;
+            if (!(file >> weight)) {
+                cerr << filename << ": не хватает весов в EDGE_WEIGHT_SECTION" << endl;
+                return false;
+            }
+            instance.graph[cell.first][cell.second] = weight;
+            if (weight_format != "FULL_MATRIX") {
+                instance.graph[cell.second][cell.first] = weight;
+            }
+        }
+        instance.euclidean = false;
+        return true;
+    }
+
+    if (weight_type != "EUC_2D" && weight_type != "CEIL_2D" && weight_type != "ATT" && weight_type != "GEO") {
+        cerr << filename << ": неподдерживаемый EDGE_WEIGHT_TYPE " << weight_type << endl;
+        return false;
+    }
+    if (section != "NODE_COORD_SECTION") {
+        cerr << filename << ": нет NODE_COORD_SECTION" << endl;
+        return false;
+    }
+
+    instance.cities.resize(n);
+    for (int i = 0; i < n; i++) {
+        int id;
+        City city;
+        if (!(file >> id >> city.x >> city.y) || id < 1 || id > n) {
+            cerr << filename << ": ошибка в NODE_COORD_SECTION" << endl;
+            return false;
+        }
+        instance.cities[id - 1] = city;
+    }
+
+    for (int i = 0; i < n; i++) {
+        for (int j = i + 1; j < n; j++) {
+            int distance = tsplibDistance(instance.cities[i], instance.cities[j], weight_type);
+            instance.graph[i][j] = distance;
+            instance.graph[j][i] = distance;
+        }
+    }
+    // ATT и CEIL_2D монотонны по евклидову расстоянию, так что ближайшие соседи те же
+    instance.euclidean = weight_type != "GEO";
+    return true;
+}
@@ -0,0 +1,30 @@
+#ifndef TSPLIB_H
+#define TSPLIB_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "colony.h"
+
+/*
+ * задача из TSPLIB (.tsp): EUC_2D, CEIL_2D, ATT, GEO и явная матрица
+ * (FULL_MATRIX, UPPER_ROW, UPPER_DIAG_ROW, LOWER_DIAG_ROW)
+ */
+struct TspInstance {
+    std::string name;
+    std::vector<std::vector<int>> graph;
+    std::vector<City> cities;    // пусто для явной матрицы
+    bool euclidean;         // соседей можно искать k-d деревом по координатам
+};
+
+// известные длины оптимальных путей для задач TSPLIB
+extern const std::map<std::string, double> TSPLIB_OPTIMA;
+
+// расстояние между городами по правилам EDGE_WEIGHT_TYPE
+int tsplibDistance(const City& a, const City& b, const std::string& type);
+
+// читаем задачу из локального файла; false — если формат не поддерживается или файл битый
+bool loadTsplib(const std::string& filename, TspInstance& instance);
+
+#endif